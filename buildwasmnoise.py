@@ -32,6 +32,16 @@ class FunctionEnableType(enum.IntEnum):
   EnableCellular = 7
   EnableCellularFractal = 8
   EnableAllCellular = 9
+  EnableViewport = 10
+  EnableValue = 11
+  EnableValueFractal = 12
+  EnableAllValue = 13
+  EnableCubic = 14
+  EnableCubicFractal = 15
+  EnableAllCubic = 16
+  EnableWhite = 17
+  EnableGraph = 18
+  EnableMesh = 19
 
 # Lookup maps to exportNames array
 enableTypeLookup = [
@@ -45,6 +55,16 @@ enableTypeLookup = [
   [0, 6, 7], # Enable Cellular
   [0, 6, 8], # Enable Cellular Fractal
   [0, 6, 7, 8], # Enable Cellular and Cellular Fractal
+  [0, 9], # Enable Viewport
+  [0, 10], # Enable Value
+  [0, 1, 11], # Enable Value Fractal
+  [0, 1, 10, 11], # Enable Value and Value Fractal
+  [0, 12], # Enable Cubic
+  [0, 1, 13], # Enable Cubic Fractal
+  [0, 1, 12, 13], # Enable Cubic and Cubic Fractal
+  [0, 14], # Enable White
+  [0, 15], # Enable Graph
+  [0, 16], # Enable Mesh
 ]
 exportNames = [
   "getset",         #0
@@ -56,6 +76,14 @@ exportNames = [
   "cellularGetSet", #6  
   "cellular",       #7
   "cellularFractal",#8
+  "viewport",       #9
+  "value",          #10
+  "valueFractal",   #11
+  "cubic",          #12
+  "cubicFractal",   #13
+  "white",          #14
+  "graph",          #15
+  "mesh",           #16
 ]
 
 class TextColours:
@@ -126,15 +154,29 @@ def main(args):
     "-EnableAllSimplex": FunctionEnableType.EnableAllSimplex,
     "-EnableCellular": FunctionEnableType.EnableCellular,
     "-EnableCellularFractal": FunctionEnableType.EnableCellularFractal,
-    "-EnableAllCellular": FunctionEnableType.EnableAllCellular
+    "-EnableAllCellular": FunctionEnableType.EnableAllCellular,
+    "-EnableViewport": FunctionEnableType.EnableViewport,
+    "-EnableValue": FunctionEnableType.EnableValue,
+    "-EnableValueFractal": FunctionEnableType.EnableValueFractal,
+    "-EnableAllValue": FunctionEnableType.EnableAllValue,
+    "-EnableCubic": FunctionEnableType.EnableCubic,
+    "-EnableCubicFractal": FunctionEnableType.EnableCubicFractal,
+    "-EnableAllCubic": FunctionEnableType.EnableAllCubic,
+    "-EnableWhite": FunctionEnableType.EnableWhite,
+    "-EnableGraph": FunctionEnableType.EnableGraph,
+    "-EnableMesh": FunctionEnableType.EnableMesh
   }
   helpArgs = ["-h", "-help", "--h", "--help", "-H", "--H"]
   allowAbortArg = "-AllowAbort"
+  hashLatticeArg = "-HashLattice"
+  useDoublesArg = "-UseDoubles"
 
   buildType = BuildType(0)
   optimisationLevel = "-O3"
   verboseMode = False  
   allowAbort = False
+  hashLattice = False
+  useDoubles = False
   enableFlags = []
 
   if(len(args) > 1):
@@ -163,9 +205,23 @@ def main(args):
         "\t-EnableCellular\t\tEnable Cellular Functions\n",
         "\t-EnableCellularFractal\tEnable Fractal Cellular Functions Only\n",
         "\t-EnableAllCellular\tEnable All Cellular Functions (Fractal and Non-Fractal)\n",
+        "\t-EnableViewport\t\tEnable Viewport Functions (Combine with the noise sets it should use)\n",
+        "\t-EnableValue\t\tEnable Non-Fractal Value Functions Only\n",
+        "\t-EnableValueFractal\tEnable Fractal Value Functions Only\n",
+        "\t-EnableAllValue\t\tEnable All Value Functions (Fractal and Non-Fractal)\n",
+        "\t-EnableCubic\t\tEnable Non-Fractal Cubic Functions Only\n",
+        "\t-EnableCubicFractal\tEnable Fractal Cubic Functions Only\n",
+        "\t-EnableAllCubic\t\tEnable All Cubic Functions (Fractal and Non-Fractal)\n",
+        "\t-EnableWhite\t\tEnable White Noise Functions\n",
+        "\t-EnableGraph\t\tEnable Noise Graph Functions (Combine with the noise sets it should use)\n",
+        "\t-EnableMesh\t\tEnable Marching Cubes Mesh Functions (Combine with the noise sets it should use)\n",
         "Allow Abort Alerts:\n",
         "(Only recommended for testing and development, not for production)\n",
         "\t-AllowAbort\n",
+        "Hash Lattice Coordinates Instead Of Using The Permutation Table:\n",
+        "\t-HashLattice\n",
+        "Build With Doubles (f64) Instead Of Floats (f32):\n",
+        "\t-UseDoubles\n",
         "This Help Message -\n",
         "\t-h --h -H --H -help --help"
       )
@@ -213,6 +269,16 @@ def main(args):
         allowAbort = True
         continue
 
+      # Check if it is a hashLattice arg
+      if arg.strip() == hashLatticeArg:
+        hashLattice = True
+        continue
+
+      # Check if it is a useDoubles arg
+      if arg.strip() == useDoublesArg:
+        useDoubles = True
+        continue
+
       # Else, unrecognised arg
       print("Ignoring Unrecongised Option '", arg, "'")
 
@@ -221,9 +287,9 @@ def main(args):
     enableFlags.append(FunctionEnableType.EnableAll)
 
   print("Building WasmNoise, incrementing", buildTypeLookup[int(buildType)])
-  build(buildType, optimisationLevel, verboseMode, allowAbort, enableFlags)
+  build(buildType, optimisationLevel, verboseMode, allowAbort, hashLattice, useDoubles, enableFlags)
 
-def build(buildType, optLevel, verbose, allowAbort, enabledFlags):
+def build(buildType, optLevel, verbose, allowAbort, hashLattice, useDoubles, enabledFlags):
   #TODO: Break version increment off into own function for neatness
   """
   Build process, multi-step
@@ -255,6 +321,8 @@ def build(buildType, optLevel, verbose, allowAbort, enabledFlags):
 
   # File output name (minus file type)
   outName = "wasmnoise-" + config["VERSION"]["major"] + '.' + config["VERSION"]["minor"] + '.' + config["VERSION"]["patch"]
+  if useDoubles:
+    outName += ".f64"
 
   # Save the modified file
   with open(iniLoc, 'w') as configfile:
@@ -309,6 +377,10 @@ def build(buildType, optLevel, verbose, allowAbort, enabledFlags):
     clangCmd.append(macro)
   if allowAbort:
     clangCmd.append("-DWN_ALLOW_ABORT")
+  if hashLattice:
+    clangCmd.append("-DWN_USE_HASH_LATTICE")
+  if useDoubles:
+    clangCmd.append("-DWN_USE_DOUBLES")
   
   if verbose:
     clangCmd.append("-v")
@@ -373,7 +445,7 @@ def build(buildType, optLevel, verbose, allowAbort, enabledFlags):
   print(TextColours.Green + "Wasm compiled successfully! " + wat2wasmOut + " file now located at " + binLoc + TextColours.StopColour)
   
   print(TextColours.Blue + "Writing Autoloader Script..." + TextColours.StopColour)
-  outputAutloaderFile(wasmoptOut, enabledFunctions, exports)  
+  outputAutloaderFile(wasmoptOut, enabledFunctions, exports, useDoubles)  
   print(TextColours.Green + "wasmnoise.autoloader.js written successfully!" + TextColours.StopColour)
 
 if __name__ == "__main__":
@@ -5,10 +5,14 @@ from string import Template
 
 WasmNoiseObjectDeclaration = "var WasmNoise = WasmNoise || { loaded: false };"
 WasmNoiseMemoryDeclaration = "WasmNoise.memory = WasmNoise.memory || new WebAssembly.Memory({initial: 9});"
+WasmNoiseDecimalArrayDeclaration = Template("WasmNoise.DecimalArray = ${arrayType};")
 WasmNoiseEnums = {
+  "NoiseType": "WasmNoise.NoiseType = WasmNoise.NoiseType || Object.freeze({Perlin: 0, PerlinFractal: 1, Simplex: 2, Cellular: 3, SimplexFractal: 4, CellularFractal: 5, Value: 6, ValueFractal: 7, Cubic: 8, CubicFractal: 9, White: 10});",
   "Interp": "WasmNoise.Interp = WasmNoise.Interp || Object.freeze({Linear: 0, Hermite: 1, Quintic: 2});",
   "FractalType":"WasmNoise.FractalType = WasmNoise.FractalType || Object.freeze({FBM: 0, Billow: 1, RidgedMulti: 2});",
   "StripDirection":"WasmNoise.StripDirection = WasmNoise.StripDirection || Object.freeze({XAxis: 0, YAxis: 1, ZAxis: 2, WAxis: 3});",
+  "GraphOp":"WasmNoise.GraphOp = WasmNoise.GraphOp || Object.freeze({Source: 0, Constant: 1, Add: 2, Multiply: 3, Min: 4, Max: 5, Clamp: 6, Select: 7});",
+  "OutputLayout":"WasmNoise.OutputLayout = WasmNoise.OutputLayout || Object.freeze({RowMajor: 0, Morton: 1, YZX: 2, Brick: 3});",
   "SquarePlane":"WasmNoise.SquarePlane = WasmNoise.SquarePlane || Object.freeze({XYPlane: 0, XZPlane: 1, ZYPlane: 2, XWPlane: 3, YWPlane: 4, ZWPlane: 5});",
   "CellularDistanceFunction":"WasmNoise.CellularDistanceFunction = WasmNoise.CellularDistanceFunction || Object.freeze({Euclidean: 0, Manhattan: 1, Natural: 2});",
   "CellularReturnType":"WasmNoise.CellularReturnType = WasmNoise.CellularReturnType || Object.freeze({CellValue: 0, Distance: 1, Distance2: 2, Distance2Add: 3, Distance2Sub: 4, Distance2Mul: 5, Distance2Div: 6, NoiseLookupPerlin: 7, NoiseLookupSimplex: 8});"
@@ -23,24 +27,26 @@ def constructValuesFunc(funcName, funcType):
     "this.${func}_${funcType}_Values = function(${startParams}, ${otherParams})"+
     "{" +
     "let offset = this.${func}_${funcType}(${startParams}, ${otherParams});" +
-    "return new Float32Array(this.memory.buffer.slice(offset, offset+${size}));" +
+    "return new this.DecimalArray(this.memory.buffer.slice(offset, offset+${size}));" +
     "}")
+  # Row-major squares and cubes are padded out to the output row stride
+  rowLength = "(this.GetOutputLayout() === 0 ? Math.max(width, this.GetOutputRowStride()) : width)"
   startParams = "startX, startY" if funcName[-1] is '2' else ("startX, startY, startZ" if (funcName[-1] is '3') else "startX, startY, startZ, startW")
   otherParams = str()
   size = str()
   if funcName[-1] is '2':
     otherParams = "length, direction" if funcType is "Strip" else "width, height"
-    size = "length*4" if funcType is "Strip" else "width*height*4"
+    size = "length*this.DecimalArray.BYTES_PER_ELEMENT" if funcType is "Strip" else rowLength + "*height*this.DecimalArray.BYTES_PER_ELEMENT"
   else:
     if funcType is "Strip":
       otherParams = "length, direction"
-      size = "length*4"
+      size = "length*this.DecimalArray.BYTES_PER_ELEMENT"
     elif funcType is "Square":
       otherParams = "width, height, plane"
-      size = "width*height*4"
+      size = rowLength + "*height*this.DecimalArray.BYTES_PER_ELEMENT"
     elif funcType is "Cube":
       otherParams = "width, height, depth"
-      size = "width*height*depth*4"
+      size = rowLength + "*height*depth*this.DecimalArray.BYTES_PER_ELEMENT"
   return funcTemplate.substitute(func=funcName, funcType=funcType, startParams=startParams, otherParams=otherParams, size=size)
 
 def constructFunctionElevation(funcName):
@@ -87,7 +93,11 @@ def constructFetchCompileAndInstantiateFunction(filename, enabledFunctions, expo
     "${valueFunctions}" +
     "this.GetValues = function(offset, elements)" +
     "{" +
-    "return new Float32Array(this.memory.buffer.slice(offset, offset+(elements*4)));" +
+    "return new this.DecimalArray(this.memory.buffer.slice(offset, offset+(elements*this.DecimalArray.BYTES_PER_ELEMENT)));" +
+    "}\n" +
+    "this.GetMask = function(offset, samples)" +
+    "{" +
+    "return new Uint32Array(this.memory.buffer.slice(offset, offset+(Math.ceil(samples/32)*4)));" +
     "}\n" +
     "this.loaded = true;" +
     "if(this.onLoaded) this.onLoaded();" +
@@ -131,21 +141,27 @@ def constructFetchCompileAndInstantiateFunction(filename, enabledFunctions, expo
   }
   return funcTemplate.substitute(params)
 
-def outputAutloaderFile(fileName, enabledFunctions, exports):
+def outputAutloaderFile(fileName, enabledFunctions, exports, useDoubles=False):
   """
   Constructs and writes a js file based on the given filename and the enabled
-  function sets
+  function sets, returning values as a Float64Array for f64 builds
   """
   with open("wasmnoise.autoloader.js", "w") as file:
     file.write(WasmNoiseObjectDeclaration + "\n")
     file.write(WasmNoiseMemoryDeclaration + "\n")
+    file.write(WasmNoiseDecimalArrayDeclaration.substitute(arrayType=("Float64Array" if useDoubles else "Float32Array")) + "\n")
     file.write(WasmNoiseEnums["Interp"] + "\n")
     if "fractalGetSet" in enabledFunctions:
       file.write(WasmNoiseEnums["FractalType"] + "\n")
     file.write(WasmNoiseEnums["StripDirection"] + "\n")
     file.write(WasmNoiseEnums["SquarePlane"] + "\n")
+    file.write(WasmNoiseEnums["OutputLayout"] + "\n")
     file.write(WasmNoiseEnums["CellularDistanceFunction"] + "\n")
     file.write(WasmNoiseEnums["CellularReturnType"] + "\n")
+    if "viewport" in enabledFunctions or "graph" in enabledFunctions or "mesh" in enabledFunctions:
+      file.write(WasmNoiseEnums["NoiseType"] + "\n")
+    if "graph" in enabledFunctions:
+      file.write(WasmNoiseEnums["GraphOp"] + "\n")
     file.write(constructFetchCompileAndInstantiateFunction(fileName, enabledFunctions, exports) + "\n")
     file.write(WasmNoiseOnLoadedDef + "\n")
     file.write(WasmNoiseCallCompile + "\n")
@@ -1,21 +1,22 @@
 #pragma once
 #include "defineconfig.hpp"
 
-// A helper class
+// A helper class, holds the most recently returned array until the next one replaces it
+template<class T = WN_DECIMAL>
 class ReturnArrayHelper
 {
-  WN_DECIMAL *array;
+  T *array;
 public:
   ReturnArrayHelper()
     : array(nullptr)
   {}
-  WN_DECIMAL *NewArray(int num)
+  T *NewArray(int num)
   {
     if(array != nullptr)
     {
       delete[] array;
     }
-    array = new WN_DECIMAL[num];
+    array = new T[num];
     return array;
   }
 };
@@ -118,13 +118,12 @@ WN_INLINE void WasmNoise::SetCellularDistance2Indices(int32 _cellularDistanceInd
 // These functions are required for both regular and fractal cellular noise
 
 // 2D
-WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, int32 &xc, int32 &yc) const
 {
   int32 xr = FastRound(x);
   int32 yr = FastRound(y);
 
   WN_DECIMAL distance = 999999;
-  int32 xc, yc;
 
   switch(cellularDistanceFunction)
   {
@@ -135,7 +134,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
 
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -158,7 +157,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
 
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -181,7 +180,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
 
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -200,26 +199,63 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }    
   }
 
+  return distance;
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, int32 &xc, int32 &yc) const
+{
+  return latticeShifted ? SingleCellularNearest<true>(offset, x, y, xc, yc) : SingleCellularNearest<false>(offset, x, y, xc, yc);
+}
+
+// The noise is looked up at the cell's lattice coordinates after the chunk origin and period, so the 
+// lookup noise itself is sampled unshifted
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::CellularNoiseLookup(uint8 offset, int32 xc, int32 yc) const
+{
+#if !defined(WN_INCLUDE_PERLIN) && !defined(WN_INCLUDE_SIMPLEX)
+  // Without a noise type to look up only the default case is left
+  (void)offset; (void)xc; (void)yc;
+#endif
   switch(cellularReturnType)
   {
-  case CellularReturnType::CellValue:
-  {
-    return ValCoord2D(seed, xc, yc);
-  }
 #ifdef WN_INCLUDE_PERLIN
   case CellularReturnType::NoiseLookupPerlin:
   {
-    uint8 lutPos = Index2D_256(offset, xc, yc);
-    return SinglePerlin(offset, (xc + CELL_2D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (yc + CELL_2D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
+    uint8 lutPos = Index2D_256<Shifted>(offset, xc, yc);
+    return SinglePerlin<false>(offset, (LatticeX<Shifted>(xc) + CELL_2D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeY<Shifted>(yc) + CELL_2D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
   }
 #endif // WN_INCLUDE_PERLIN
 #ifdef WN_INCLUDE_SIMPLEX
   case CellularReturnType::NoiseLookupSimplex:
   {
-    uint8 lutPos = Index2D_256(offset, xc, yc);
-    return SingleSimplex(offset, (xc + CELL_2D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (yc + CELL_2D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
+    uint8 lutPos = Index2D_256<Shifted>(offset, xc, yc);
+    return SingleSimplex<false>(offset, (LatticeX<Shifted>(xc) + CELL_2D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeY<Shifted>(yc) + CELL_2D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
   }
 #endif
+  default: return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::CellularNoiseLookup(uint8 offset, int32 xc, int32 yc) const
+{
+  return latticeShifted ? CellularNoiseLookup<true>(offset, xc, yc) : CellularNoiseLookup<false>(offset, xc, yc);
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  int32 xc, yc;
+  WN_DECIMAL distance = SingleCellularNearest<Shifted>(offset, x, y, xc, yc);
+
+  switch(cellularReturnType)
+  {
+  case CellularReturnType::CellValue:
+  {
+    return ValCoord2D(seed, LatticeX<Shifted>(xc), LatticeY<Shifted>(yc));
+  }
+  case CellularReturnType::NoiseLookupPerlin:
+  case CellularReturnType::NoiseLookupSimplex:
+  {
+    return CellularNoiseLookup<Shifted>(offset, xc, yc);
+  }
   case CellularReturnType::Distance:
   {
     return distance;
@@ -228,7 +264,12 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }  
 }
 
-WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SingleCellular<true>(offset, x, y) : SingleCellular<false>(offset, x, y);
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
 {
   int32 xr = FastRound(x);
   int32 yr = FastRound(y);
@@ -244,7 +285,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
 
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -266,7 +307,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
         
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -288,7 +329,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
     {
       for(int32 yi = yr - 1; yi <= yr + 1; yi++)
       {
-        uint8 lutPos = Index2D_256(offset, xi, yi);
+        uint8 lutPos = Index2D_256<Shifted>(offset, xi, yi);
 
         WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
         WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
@@ -317,28 +358,115 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
   }
 }
 
-// 3D
-WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SingleCellular2Edge<true>(offset, x, y) : SingleCellular2Edge<false>(offset, x, y);
+}
+
+template<bool Shifted> WN_INLINE void WasmNoise::SingleCellularSearch(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL *distance, int32 &xc, int32 &yc) const
 {
   int32 xr = FastRound(x);
   int32 yr = FastRound(y);
-  int32 zr = FastRound(z);
+
+  for(int32 i = 0; i <= CellularDistanceIndexMax; i++)
+  {
+    distance[i] = 999999;
+  }
+
+  for(int32 xi = xr - 1; xi <= xr + 1; xi++)
+  {
+    for(int32 yi = yr - 1; yi <= yr + 1; yi++)
+    {
+      uint8 lutPos = Index2D_256<Shifted>(0, xi, yi);
+
+      WN_DECIMAL vecX = xi - x + CELL_2D_X[lutPos] * cellularJitter;
+      WN_DECIMAL vecY = yi - y + CELL_2D_Y[lutPos] * cellularJitter;
+
+      WN_DECIMAL newDistance;
+      switch(cellularDistanceFunction)
+      {
+      default:
+      case CellularDistanceFunction::Euclidean: newDistance = vecX*vecX + vecY*vecY; break;
+      case CellularDistanceFunction::Manhattan: newDistance = FastAbs(vecX) + FastAbs(vecY); break;
+      case CellularDistanceFunction::Natural:   newDistance = (FastAbs(vecX) + FastAbs(vecY)) + (vecX*vecX + vecY*vecY); break;
+      }
+
+      if(newDistance < distance[0])
+      {
+        xc = xi;
+        yc = yi;
+      }
+      for(int32 i = cellularDistanceIndex1; i > 0; i--)
+      {
+        distance[i] = max(min(distance[i], newDistance), distance[i - 1]);
+      }
+      distance[0] = min(distance[0], newDistance);
+    }
+  }
+}
+
+// 3D
+// The 3D nearest cell search visits the 27 cells nearest first and stops once the remaining cells 
+// can't beat the best distance so far. CellularSearchAxis gives the cells on one axis in search 
+// order (the sample's own cell, the nearer neighbour, then the farther one) with a lower bound on 
+// that axis's share of the distance to each cell's point, in the units of the current distance 
+// function. Points sit within cellularJitter of their cell on each axis, so the bounds only grow 
+// along the order
+WN_INLINE void WasmNoise::CellularSearchAxis(WN_DECIMAL v, int32 *cells, WN_DECIMAL *bounds) const
+{
+  int32 r = FastRound(v);
+  WN_DECIMAL f = v - r;
+  int32 side = (f >= 0) ? 1 : -1;
+  cells[0] = r;
+  cells[1] = r + side;
+  cells[2] = r - side;
+
+  WN_DECIMAL reach = FastAbs(cellularJitter) + CellularBoundSlack;
+  WN_DECIMAL gap[3] = { FastAbs(f) - reach, 1 - FastAbs(f) - reach, 1 + FastAbs(f) - reach };
+  for(int32 i = 0; i < 3; i++)
+  {
+    WN_DECIMAL b = max(gap[i], WN_DECIMAL(0));
+    switch(cellularDistanceFunction)
+    {
+    default:
+    case CellularDistanceFunction::Euclidean: bounds[i] = b*b; break;
+    case CellularDistanceFunction::Manhattan: bounds[i] = b; break;
+    case CellularDistanceFunction::Natural:   bounds[i] = b + b*b; break;
+    }
+  }
+}
+
+// Exact ties go to the lowest cell, as they would in a plain scan from -1 to +1
+static WN_INLINE bool CellularCloser(WN_DECIMAL newDistance, WN_DECIMAL distance, int32 xi, int32 yi, int32 zi, int32 xc, int32 yc, int32 zc)
+{
+  return newDistance < distance || (newDistance == distance && (xi < xc || (xi == xc && (yi < yc || (yi == yc && zi < zc)))));
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, int32 &xc, int32 &yc, int32 &zc) const
+{
+  int32 cellX[3], cellY[3], cellZ[3];
+  WN_DECIMAL boundX[3], boundY[3], boundZ[3];
+  CellularSearchAxis(x, cellX, boundX);
+  CellularSearchAxis(y, cellY, boundY);
+  CellularSearchAxis(z, cellZ, boundZ);
 
   WN_DECIMAL distance = 999999;
-  int32 xc, yc, zc;
 
   switch(cellularDistanceFunction)
   {
   default:
   case CellularDistanceFunction::Euclidean:
   {
-    for(int32 xi = xr - 1; xi <= xr + 1; xi++)
+    for(int32 ix = 0; ix < 3 && boundX[ix] + boundY[0] + boundZ[0] < distance; ix++)
     {
-      for(int32 yi = yr - 1; yi <= yr + 1; yi++)
+      int32 xi = cellX[ix];
+      for(int32 iy = 0; iy < 3 && boundX[ix] + boundY[iy] + boundZ[0] < distance; iy++)
       {
-        for(int32 zi = zr - 1; zi <= zr + 1; zi++)
+        int32 yi = cellY[iy];
+        for(int32 iz = 0; iz < 3 && boundX[ix] + boundY[iy] + boundZ[iz] < distance; iz++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          int32 zi = cellZ[iz];
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -346,7 +474,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
 
           WN_DECIMAL newDistance = vecX*vecX + vecY*vecY + vecZ*vecZ;
 
-          if(newDistance < distance)
+          if(CellularCloser(newDistance, distance, xi, yi, zi, xc, yc, zc))
           {
             distance = newDistance;
             xc = xi;
@@ -360,13 +488,16 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }
   case CellularDistanceFunction::Manhattan:
   {
-    for(int32 xi = xr - 1; xi <= xr + 1; xi++)
+    for(int32 ix = 0; ix < 3 && boundX[ix] + boundY[0] + boundZ[0] < distance; ix++)
     {
-      for(int32 yi = yr - 1; yi <= yr + 1; yi++)
+      int32 xi = cellX[ix];
+      for(int32 iy = 0; iy < 3 && boundX[ix] + boundY[iy] + boundZ[0] < distance; iy++)
       {
-        for(int32 zi = zr - 1; zi <= zr + 1; zi++)
+        int32 yi = cellY[iy];
+        for(int32 iz = 0; iz < 3 && boundX[ix] + boundY[iy] + boundZ[iz] < distance; iz++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          int32 zi = cellZ[iz];
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -374,7 +505,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
 
           WN_DECIMAL newDistance = (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ));
 
-          if(newDistance < distance)
+          if(CellularCloser(newDistance, distance, xi, yi, zi, xc, yc, zc))
           {
             distance = newDistance;
             xc = xi;
@@ -388,13 +519,16 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }
   case CellularDistanceFunction::Natural:
   {
-    for(int32 xi = xr - 1; xi <= xr + 1; xi++)
+    for(int32 ix = 0; ix < 3 && boundX[ix] + boundY[0] + boundZ[0] < distance; ix++)
     {
-      for(int32 yi = yr - 1; yi <= yr + 1; yi++)
+      int32 xi = cellX[ix];
+      for(int32 iy = 0; iy < 3 && boundX[ix] + boundY[iy] + boundZ[0] < distance; iy++)
       {
-        for(int32 zi = zr - 1; zi <= zr + 1; zi++)
+        int32 yi = cellY[iy];
+        for(int32 iz = 0; iz < 3 && boundX[ix] + boundY[iy] + boundZ[iz] < distance; iz++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          int32 zi = cellZ[iz];
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -402,7 +536,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
 
           WN_DECIMAL newDistance = (FastAbs(vecX) + FastAbs(vecY) + FastAbs(vecZ)) + (vecX*vecX + vecY*vecY + vecZ*vecZ);
 
-          if(newDistance < distance)
+          if(CellularCloser(newDistance, distance, xi, yi, zi, xc, yc, zc))
           {
             distance = newDistance;
             xc = xi;
@@ -416,26 +550,61 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }    
   }
 
+  return distance;
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, int32 &xc, int32 &yc, int32 &zc) const
+{
+  return latticeShifted ? SingleCellularNearest<true>(offset, x, y, z, xc, yc, zc) : SingleCellularNearest<false>(offset, x, y, z, xc, yc, zc);
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::CellularNoiseLookup(uint8 offset, int32 xc, int32 yc, int32 zc) const
+{
+#if !defined(WN_INCLUDE_PERLIN) && !defined(WN_INCLUDE_SIMPLEX)
+  // Without a noise type to look up only the default case is left
+  (void)offset; (void)xc; (void)yc; (void)zc;
+#endif
   switch(cellularReturnType)
   {
-  case CellularReturnType::CellValue:
-  {
-    return ValCoord3D(seed, xc, yc, zc);
-  }
 #ifdef WN_INCLUDE_PERLIN
   case CellularReturnType::NoiseLookupPerlin:
   {
-    uint8 lutPos = Index3D_256(offset, xc, yc, zc);
-    return SinglePerlin(offset, (xc + CELL_3D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (yc + CELL_3D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (zc + CELL_3D_Z[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
+    uint8 lutPos = Index3D_256<Shifted>(offset, xc, yc, zc);
+    return SinglePerlin<false>(offset, (LatticeX<Shifted>(xc) + CELL_3D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeY<Shifted>(yc) + CELL_3D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeZ<Shifted>(zc) + CELL_3D_Z[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
   }
 #endif // WN_INCLUDE_PERLIN
 #ifdef WN_INCLUDE_SIMPLEX
   case CellularReturnType::NoiseLookupSimplex:
   {
-    uint8 lutPos = Index3D_256(offset, xc, yc, zc);
-    return SingleSimplex(offset, (xc + CELL_3D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (yc + CELL_3D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (zc + CELL_3D_Z[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
+    uint8 lutPos = Index3D_256<Shifted>(offset, xc, yc, zc);
+    return SingleSimplex<false>(offset, (LatticeX<Shifted>(xc) + CELL_3D_X[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeY<Shifted>(yc) + CELL_3D_Y[lutPos] * cellularJitter) * cellularNoiseLookupFrequency, (LatticeZ<Shifted>(zc) + CELL_3D_Z[lutPos] * cellularJitter) * cellularNoiseLookupFrequency);
   }
 #endif
+  default: return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::CellularNoiseLookup(uint8 offset, int32 xc, int32 yc, int32 zc) const
+{
+  return latticeShifted ? CellularNoiseLookup<true>(offset, xc, yc, zc) : CellularNoiseLookup<false>(offset, xc, yc, zc);
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  int32 xc, yc, zc;
+  WN_DECIMAL distance = SingleCellularNearest<Shifted>(offset, x, y, z, xc, yc, zc);
+
+  switch(cellularReturnType)
+  {
+  case CellularReturnType::CellValue:
+  {
+    return ValCoord3D(seed, LatticeX<Shifted>(xc), LatticeY<Shifted>(yc), LatticeZ<Shifted>(zc));
+  }
+  case CellularReturnType::NoiseLookupPerlin:
+  case CellularReturnType::NoiseLookupSimplex:
+  {
+    return CellularNoiseLookup<Shifted>(offset, xc, yc, zc);
+  }
   case CellularReturnType::Distance:
   {
     return distance;
@@ -444,7 +613,12 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DE
   }  
 }
 
-WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SingleCellular<true>(offset, x, y, z) : SingleCellular<false>(offset, x, y, z);
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
 {
   int32 xr = FastRound(x);
   int32 yr = FastRound(y);
@@ -462,7 +636,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
       {
         for(int32 zi = zr - 1; zi <= zr + 1; zi++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -488,7 +662,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
       {
         for(int32 zi = zr - 1; zi <= zr + 1; zi++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -514,7 +688,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
       {
         for(int32 zi = zr - 1; zi <= zr + 1; zi++)
         {
-          uint8 lutPos = Index3D_256(offset, xi, yi, zi);
+          uint8 lutPos = Index3D_256<Shifted>(offset, xi, yi, zi);
 
           WN_DECIMAL vecX = xi - x + CELL_3D_X[lutPos] * cellularJitter;
           WN_DECIMAL vecY = yi - y + CELL_3D_Y[lutPos] * cellularJitter;
@@ -545,6 +719,11 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x,
   }
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SingleCellular2Edge<true>(offset, x, y, z) : SingleCellular2Edge<false>(offset, x, y, z);
+}
+
 // Functionally aliases which fill in the offset parameter, allowing them to share
 // the same parameter order as the fractal functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularNoOffset(WN_DECIMAL x, WN_DECIMAL y)
@@ -567,67 +746,115 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeNoOffset(WN_DECIMAL x, WN_DEC
   return SingleCellular2Edge(0, x, y, z);
 }
 
+#ifdef WN_INCLUDE_CELLULAR
+// Noise lookup kernels for the bulk functions. Neighbouring samples nearly always share a cell, so
+// the lookup noise is kept per cell in a small direct mapped cache, which the bulk functions clear
+// before each call
+WN_INLINE void WasmNoise::ClearCellularCache()
+{
+  for(uint32 i = 0; i < CellularCacheSize; i++)
+  {
+    cellularCacheValid[i] = 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellularCachedNoOffset(WN_DECIMAL x, WN_DECIMAL y)
+{
+  int32 xc, yc;
+  SingleCellularNearest(0, x, y, xc, yc);
+
+  // 16x16 tile of cells
+  uint32 slot = (xc & 15) | ((yc & 15) << 4);
+  if(!cellularCacheValid[slot] || cellularCacheX[slot] != xc || cellularCacheY[slot] != yc)
+  {
+    cellularCacheValid[slot] = 1;
+    cellularCacheX[slot] = xc;
+    cellularCacheY[slot] = yc;
+    cellularCacheValue[slot] = CellularNoiseLookup(0, xc, yc);
+  }
+  return cellularCacheValue[slot];
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCellularCachedNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  int32 xc, yc, zc;
+  SingleCellularNearest(0, x, y, z, xc, yc, zc);
+
+  // 8x8x4 block of cells
+  uint32 slot = (xc & 7) | ((yc & 7) << 3) | ((zc & 3) << 6);
+  if(!cellularCacheValid[slot] || cellularCacheX[slot] != xc || cellularCacheY[slot] != yc || cellularCacheZ[slot] != zc)
+  {
+    cellularCacheValid[slot] = 1;
+    cellularCacheX[slot] = xc;
+    cellularCacheY[slot] = yc;
+    cellularCacheZ[slot] = zc;
+    cellularCacheValue[slot] = CellularNoiseLookup(0, xc, yc, zc);
+  }
+  return cellularCacheValue[slot];
+}
+#endif // WN_INCLUDE_CELLULAR
+
 #ifdef WN_INCLUDE_CELLULAR_FRACTAL
 // 2D Cellular Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalFBM(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalFBM<Single2DFPtr>(&WasmNoise::SingleCellular, x, y);
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SingleCellular>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalBillow(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalBillow<Single2DFPtr>(&WasmNoise::SingleCellular, x, y);
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SingleCellular>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalRidgedMulti<Single2DFPtr>(&WasmNoise::SingleCellular, x, y);
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SingleCellular>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalFBM(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalFBM<Single2DFPtr>(&WasmNoise::SingleCellular2Edge, x, y);
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SingleCellular2Edge>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalBillow(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalBillow<Single2DFPtr>(&WasmNoise::SingleCellular2Edge, x, y);
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SingleCellular2Edge>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalRidgedMulti<Single2DFPtr>(&WasmNoise::SingleCellular2Edge, x, y);
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SingleCellular2Edge>(), x, y);
 }
 
 // 3D Cellular Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalFBM<Single3DFPtr>(&WasmNoise::SingleCellular, x, y, z);
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SingleCellular>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalBillow<Single3DFPtr>(&WasmNoise::SingleCellular, x, y, z);
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SingleCellular>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellularFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalRidgedMulti<Single3DFPtr>(&WasmNoise::SingleCellular, x, y, z);
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SingleCellular>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalFBM<Single3DFPtr>(&WasmNoise::SingleCellular2Edge, x, y, z);
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SingleCellular2Edge>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalBillow<Single3DFPtr>(&WasmNoise::SingleCellular2Edge, x, y, z);
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SingleCellular2Edge>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleCellular2EdgeFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalRidgedMulti<Single3DFPtr>(&WasmNoise::SingleCellular2Edge, x, y, z);
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SingleCellular2Edge>(), x, y, z);
 }
 #endif
 
@@ -664,14 +891,18 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularStrip(WN_DECIMAL startX, WN_DECIMAL
   {
   case CellularReturnType::CellValue:
   case CellularReturnType::Distance:
+  {
+    return GetStrip(Kernel2D<&WasmNoise::SingleCellularNoOffset>(), length, direction, startX, startY);
+  }
   case CellularReturnType::NoiseLookupPerlin:
   case CellularReturnType::NoiseLookupSimplex:
   {
-    return GetStrip<>(&WasmNoise::SingleCellularNoOffset, length, direction, startX, startY);
+    ClearCellularCache();
+    return GetStrip(Kernel2D<&WasmNoise::SingleCellularCachedNoOffset>(), length, direction, startX, startY);
   }
   default: // Distance2
   {
-    return GetStrip<>(&WasmNoise::SingleCellular2EdgeNoOffset, length, direction, startX, startY);
+    return GetStrip(Kernel2D<&WasmNoise::SingleCellular2EdgeNoOffset>(), length, direction, startX, startY);
   }
   }
 }
@@ -682,18 +913,101 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularSquare(WN_DECIMAL startX, WN_DECIMAL
   {
   case CellularReturnType::CellValue:
   case CellularReturnType::Distance:
+  {
+    return GetSquare(Kernel2D<&WasmNoise::SingleCellularNoOffset>(), width, height, startX, startY);
+  }
   case CellularReturnType::NoiseLookupPerlin:
   case CellularReturnType::NoiseLookupSimplex:
   {
-    return GetSquare<>(&WasmNoise::SingleCellularNoOffset, width, height, startX, startY);
+    ClearCellularCache();
+    return GetSquare(Kernel2D<&WasmNoise::SingleCellularCachedNoOffset>(), width, height, startX, startY);
   }
   default: // Distance2
   {
-    return GetSquare<>(&WasmNoise::SingleCellular2EdgeNoOffset, width, height, startX, startY);
+    return GetSquare(Kernel2D<&WasmNoise::SingleCellular2EdgeNoOffset>(), width, height, startX, startY);
   }
   }
 }
 
+// Planes are filled sample by sample, so every output comes from the same search. The output 
+// layout, target and remap curve don't apply
+WN_INLINE WN_DECIMAL *WasmNoise::GetCellularSquareOutputs(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 outputs)
+{
+  // F1, F2, F2 - F1, cell value, cell ID, offset x and offset y
+  const uint32 planeFlags[7] = { CellularOutputF1, CellularOutputF2, CellularOutputF2SubF1, CellularOutputCellValue, CellularOutputCellID, CellularOutputOffset, CellularOutputOffset };
+  uint32 planeCount = 0;
+  for(uint32 p = 0; p < 7; p++)
+  {
+    planeCount += (outputs & planeFlags[p]) ? 1 : 0;
+  }
+  if(planeCount == 0)
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  uint32 planeSize = width * height;
+  WN_DECIMAL *values = returnHelper.NewArray(planeCount * planeSize);
+  WN_DECIMAL *planes[7];
+  WN_DECIMAL *next = values;
+  for(uint32 p = 0; p < 7; p++)
+  {
+    planes[p] = nullptr;
+    if(outputs & planeFlags[p])
+    {
+      planes[p] = next;
+      next += planeSize;
+    }
+  }
+
+  latticeShifted ? FillCellularOutputs<true>(planes, startX, startY, width, height) : FillCellularOutputs<false>(planes, startX, startY, width, height);
+  return values;
+}
+
+template<bool Shifted> WN_INLINE void WasmNoise::FillCellularOutputs(WN_DECIMAL *const *planes, WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) const
+{
+  WN_DECIMAL distance[CellularDistanceIndexMax + 1];
+  int32 xc = 0, yc = 0;
+  uint32 i = 0;
+  for(uint32 y = 0; y < height; y++)
+  {
+    WN_DECIMAL yf = (startY + y*sampleStepY) * frequency;
+    for(uint32 x = 0; x < width; x++, i++)
+    {
+      WN_DECIMAL xf = (startX + x*sampleStepX) * frequency;
+      SingleCellularSearch<Shifted>(xf, yf, distance, xc, yc);
+
+      if(planes[0] != nullptr)
+      {
+        planes[0][i] = distance[0];
+      }
+      if(planes[1] != nullptr)
+      {
+        planes[1][i] = distance[cellularDistanceIndex1];
+      }
+      if(planes[2] != nullptr)
+      {
+        planes[2][i] = distance[cellularDistanceIndex1] - distance[cellularDistanceIndex0];
+      }
+      if(planes[3] != nullptr)
+      {
+        planes[3][i] = ValCoord2D(seed, LatticeX<Shifted>(xc), LatticeY<Shifted>(yc));
+      }
+      if(planes[4] != nullptr)
+      {
+        int32 n = seed ^ (XPrime * LatticeX<Shifted>(xc)) ^ (YPrime * LatticeY<Shifted>(yc));
+        n = n * n * n * 60493;
+        planes[4][i] = static_cast<WN_DECIMAL>(static_cast<uint32>(n) >> 8);
+      }
+      if(planes[5] != nullptr)
+      {
+        uint8 lutPos = Index2D_256<Shifted>(0, xc, yc);
+        planes[5][i] = xc - xf + CELL_2D_X[lutPos] * cellularJitter;
+        planes[6][i] = yc - yf + CELL_2D_Y[lutPos] * cellularJitter;
+      }
+    }
+  }
+}
 
 // 3D Single
 WN_INLINE WN_DECIMAL WasmNoise::GetCellular(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
@@ -724,14 +1038,18 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularStrip(WN_DECIMAL startX, WN_DECIMAL
   {
   case CellularReturnType::CellValue:
   case CellularReturnType::Distance:
+  {
+    return GetStrip(Kernel3D<&WasmNoise::SingleCellularNoOffset>(), length, direction, startX, startY, startZ);
+  }
   case CellularReturnType::NoiseLookupPerlin:
   case CellularReturnType::NoiseLookupSimplex:
   {
-    return GetStrip<>(&WasmNoise::SingleCellularNoOffset, length, direction, startX, startY, startZ);
+    ClearCellularCache();
+    return GetStrip(Kernel3D<&WasmNoise::SingleCellularCachedNoOffset>(), length, direction, startX, startY, startZ);
   }
   default: // Distance2
   {
-    return GetStrip<>(&WasmNoise::SingleCellular2EdgeNoOffset, length, direction, startX, startY, startZ);
+    return GetStrip(Kernel3D<&WasmNoise::SingleCellular2EdgeNoOffset>(), length, direction, startX, startY, startZ);
   }
   }
 }
@@ -742,14 +1060,18 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularSquare(WN_DECIMAL startX, WN_DECIMAL
   {
   case CellularReturnType::CellValue:
   case CellularReturnType::Distance:
+  {
+    return GetSquare(Kernel3D<&WasmNoise::SingleCellularNoOffset>(), width, height, plane, startX, startY, startZ);
+  }
   case CellularReturnType::NoiseLookupPerlin:
   case CellularReturnType::NoiseLookupSimplex:
   {
-    return GetSquare<>(&WasmNoise::SingleCellularNoOffset, width, height, plane, startX, startY, startZ);
+    ClearCellularCache();
+    return GetSquare(Kernel3D<&WasmNoise::SingleCellularCachedNoOffset>(), width, height, plane, startX, startY, startZ);
   }
   default: // Distance2
   {
-    return GetSquare<>(&WasmNoise::SingleCellular2EdgeNoOffset, width, height, plane, startX, startY, startZ);
+    return GetSquare(Kernel3D<&WasmNoise::SingleCellular2EdgeNoOffset>(), width, height, plane, startX, startY, startZ);
   }
   }
 }
@@ -760,14 +1082,18 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularCube(WN_DECIMAL startX, WN_DECIMAL s
   {
   case CellularReturnType::CellValue:
   case CellularReturnType::Distance:
+  {
+    return GetCube(Kernel3D<&WasmNoise::SingleCellularNoOffset>(), width, height, depth, startX, startY, startZ);
+  }
   case CellularReturnType::NoiseLookupPerlin:
   case CellularReturnType::NoiseLookupSimplex:
   {
-    return GetCube<>(&WasmNoise::SingleCellularNoOffset, width, height, depth, startX, startY, startZ);
+    ClearCellularCache();
+    return GetCube(Kernel3D<&WasmNoise::SingleCellularCachedNoOffset>(), width, height, depth, startX, startY, startZ);
   }
   default: // Distance2
   {
-    return GetCube<>(&WasmNoise::SingleCellular2EdgeNoOffset, width, height, depth, startX, startY, startZ);
+    return GetCube(Kernel3D<&WasmNoise::SingleCellular2EdgeNoOffset>(), width, height, depth, startX, startY, startZ);
   }
   }
 }
@@ -820,9 +1146,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalStrip(WN_DECIMAL startX, WN_D
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleCellularFractalFBM, length, direction, startX, startY);
-    case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleCellularFractalBillow, length, direction, startX, startY);
-    case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleCellularFractalRidgedMulti, length, direction, startX, startY);
+    case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SingleCellularFractalFBM>(), length, direction, startX, startY);
+    case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SingleCellularFractalBillow>(), length, direction, startX, startY);
+    case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SingleCellularFractalRidgedMulti>(), length, direction, startX, startY);
     default:
       ABORT();
       return 0;
@@ -832,9 +1158,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalStrip(WN_DECIMAL startX, WN_D
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalFBM, length, direction, startX, startY);
-    case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalBillow, length, direction, startX, startY);
-    case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalRidgedMulti, length, direction, startX, startY);
+    case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalFBM>(), length, direction, startX, startY);
+    case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalBillow>(), length, direction, startX, startY);
+    case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalRidgedMulti>(), length, direction, startX, startY);
     default:
       ABORT();
       return 0;
@@ -854,9 +1180,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalSquare(WN_DECIMAL startX, WN_
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleCellularFractalFBM, length, height, startX, startY);
-    case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleCellularFractalBillow, length, height, startX, startY);
-    case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleCellularFractalRidgedMulti, length, height, startX, startY);
+    case FractalType::FBM:          return GetSquare(Kernel2D<&WasmNoise::SingleCellularFractalFBM>(), length, height, startX, startY);
+    case FractalType::Billow:       return GetSquare(Kernel2D<&WasmNoise::SingleCellularFractalBillow>(), length, height, startX, startY);
+    case FractalType::RidgedMulti:  return GetSquare(Kernel2D<&WasmNoise::SingleCellularFractalRidgedMulti>(), length, height, startX, startY);
     default:
       ABORT();
       return 0;
@@ -866,9 +1192,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalSquare(WN_DECIMAL startX, WN_
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalFBM, length, height, startX, startY);
-    case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalBillow, length, height, startX, startY);
-    case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalRidgedMulti, length, height, startX, startY);
+    case FractalType::FBM:          return GetSquare(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalFBM>(), length, height, startX, startY);
+    case FractalType::Billow:       return GetSquare(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalBillow>(), length, height, startX, startY);
+    case FractalType::RidgedMulti:  return GetSquare(Kernel2D<&WasmNoise::SingleCellular2EdgeFractalRidgedMulti>(), length, height, startX, startY);
     default:
       ABORT();
       return 0;
@@ -923,9 +1249,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalStrip(WN_DECIMAL startX, WN_D
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleCellularFractalFBM, length, direction, startX, startY, startZ);
-    case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleCellularFractalBillow, length, direction, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleCellularFractalRidgedMulti, length, direction, startX, startY, startZ);
+    case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SingleCellularFractalFBM>(), length, direction, startX, startY, startZ);
+    case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SingleCellularFractalBillow>(), length, direction, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SingleCellularFractalRidgedMulti>(), length, direction, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -935,9 +1261,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalStrip(WN_DECIMAL startX, WN_D
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalFBM, length, direction, startX, startY, startZ);
-    case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalBillow, length, direction, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleCellular2EdgeFractalRidgedMulti, length, direction, startX, startY, startZ);
+    case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalFBM>(), length, direction, startX, startY, startZ);
+    case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalBillow>(), length, direction, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalRidgedMulti>(), length, direction, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -957,9 +1283,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalSquare(WN_DECIMAL startX, WN_
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleCellularFractalFBM, length, height, plane, startX, startY, startZ);
-    case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleCellularFractalBillow, length, height, plane, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleCellularFractalRidgedMulti, length, height, plane, startX, startY, startZ);
+    case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SingleCellularFractalFBM>(), length, height, plane, startX, startY, startZ);
+    case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SingleCellularFractalBillow>(), length, height, plane, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SingleCellularFractalRidgedMulti>(), length, height, plane, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -969,9 +1295,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalSquare(WN_DECIMAL startX, WN_
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalFBM, length, height, plane, startX, startY, startZ);
-    case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalBillow, length, height, plane, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleCellular2EdgeFractalRidgedMulti, length, height, plane, startX, startY, startZ);
+    case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalFBM>(), length, height, plane, startX, startY, startZ);
+    case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalBillow>(), length, height, plane, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalRidgedMulti>(), length, height, plane, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -991,9 +1317,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalCube(WN_DECIMAL startX, WN_DE
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetCube<>(&WasmNoise::SingleCellularFractalFBM, width, height, depth, startX, startY, startZ);
-    case FractalType::Billow:       return GetCube<>(&WasmNoise::SingleCellularFractalBillow, width, height, depth, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetCube<>(&WasmNoise::SingleCellularFractalRidgedMulti, width, height, depth, startX, startY, startZ);
+    case FractalType::FBM:          return GetCube(Kernel3D<&WasmNoise::SingleCellularFractalFBM>(), width, height, depth, startX, startY, startZ);
+    case FractalType::Billow:       return GetCube(Kernel3D<&WasmNoise::SingleCellularFractalBillow>(), width, height, depth, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetCube(Kernel3D<&WasmNoise::SingleCellularFractalRidgedMulti>(), width, height, depth, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -1003,9 +1329,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetCellularFractalCube(WN_DECIMAL startX, WN_DE
   {
     switch(fractalType)
     {
-    case FractalType::FBM:          return GetCube<>(&WasmNoise::SingleCellular2EdgeFractalFBM, width, height, depth, startX, startY, startZ);
-    case FractalType::Billow:       return GetCube<>(&WasmNoise::SingleCellular2EdgeFractalBillow, width, height, depth, startX, startY, startZ);
-    case FractalType::RidgedMulti:  return GetCube<>(&WasmNoise::SingleCellular2EdgeFractalRidgedMulti, width, height, depth, startX, startY, startZ);
+    case FractalType::FBM:          return GetCube(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalFBM>(), width, height, depth, startX, startY, startZ);
+    case FractalType::Billow:       return GetCube(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalBillow>(), width, height, depth, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetCube(Kernel3D<&WasmNoise::SingleCellular2EdgeFractalRidgedMulti>(), width, height, depth, startX, startY, startZ);
     default:
       ABORT();
       return 0;
@@ -35,13 +35,32 @@ constexpr WN_DECIMAL GRAD_4D[] =
   -1,1,1,0,-1,1,-1,0,-1,-1,1,0,-1,-1,-1,0
 };
 
+// Cubic noise can overshoot [-1, 1] by up to 1.5 per axis
+constexpr WN_DECIMAL CUBIC_2D_BOUNDING = 1 / (WN_DECIMAL(1.5) * WN_DECIMAL(1.5));
+constexpr WN_DECIMAL CUBIC_3D_BOUNDING = 1 / (WN_DECIMAL(1.5) * WN_DECIMAL(1.5) * WN_DECIMAL(1.5));
+
 constexpr int32 XPrime = 1619;
 constexpr int32 YPrime = 31337;
 constexpr int32 ZPrime = 6971;
 constexpr int32 WPrime = 1013;
+#ifdef WN_USE_HASH_LATTICE
+constexpr int32 OffsetPrime = 1000003;
 
-static WN_INLINE int32 FastFloor(WN_DECIMAL f) { return (f >= 0 ? static_cast<int32>(f) : static_cast<int32>(f) - 1); }
+// Finishes a lattice hash built by xoring the prime multiplied coordinates together
+static WN_INLINE uint32 LatticeHash(int32 n)
+{
+  n = n * n * n * 60493;
+  return static_cast<uint32>((n >> 13) ^ n);
+}
+#endif
+
+// Truncates then steps down if that rounded up, so negative whole numbers floor to themselves
+static WN_INLINE int32 FastFloor(WN_DECIMAL f) { int32 i = static_cast<int32>(f); return (f < static_cast<WN_DECIMAL>(i)) ? i - 1 : i; }
 static WN_INLINE int32 FastRound(WN_DECIMAL f) { return (f >= 0 ? static_cast<int32>(f + WN_DECIMAL(0.5)) : static_cast<int32>(f - WN_DECIMAL(0.5))); }
+// Wraps i into [0, n), handling negative values
+static WN_INLINE int32 WrapIndex(int32 i, int32 n) { int32 r = i % n; return (r < 0) ? r + n : r; }
+// Wraps a lattice coordinate into [0, period), a period of 0 leaves it unbounded
+static WN_INLINE int32 WrapPeriod(int32 i, int32 period) { return (period > 0) ? WrapIndex(i, period) : i; }
 static WN_INLINE int32 FastAbs(int32 i) { return __builtin_labs(i); }
 static WN_INLINE WN_DECIMAL FastAbs(WN_DECIMAL f){ return __builtin_fabs(f); }
 static WN_INLINE WN_DECIMAL Lerp(WN_DECIMAL a, WN_DECIMAL b, WN_DECIMAL t) { return a + t * (b - a); }
@@ -60,13 +79,33 @@ static WN_INLINE void Clamp(WN_DECIMAL &value, WN_DECIMAL minValue, WN_DECIMAL m
   value = max(minValue, min(value, maxValue));
 }
 
+// Maps a permutation table entry onto [-1, 1]
+static WN_INLINE WN_DECIMAL ValFromIndex(uint8 i) { return i * (WN_DECIMAL(2) / WN_DECIMAL(255)) - 1; }
+
+// Maps a coordinate hash onto [-1, 1]
+static WN_INLINE WN_DECIMAL ValFromHash(int32 n) { return (n * n * n * 60493) / WN_DECIMAL(2147483648); }
+
+// Reinterprets the bits of a float as an integer for hashing
+static WN_INLINE int32 FloatCast2Int(WN_DECIMAL f)
+{
+#ifdef WN_USE_DOUBLES
+  int64 i;
+  __builtin_memcpy(&i, &f, sizeof(f));
+  return static_cast<int32>(i ^ (i >> 32));
+#else
+  int32 i;
+  __builtin_memcpy(&i, &f, sizeof(f));
+  return i ^ (i >> 16);
+#endif
+}
+
 static WN_INLINE WN_DECIMAL ValCoord2D(int32 seed, int32 x, int32 y)
 {
   int32 n = seed;
   n ^= XPrime * x;
   n ^= YPrime * y;
 
-  return (n * n * n * 60493) / WN_DECIMAL(2147483648);
+  return ValFromHash(n);
 }
 
 static WN_INLINE WN_DECIMAL ValCoord3D(int32 seed, int32 x, int32 y, int32 z)
@@ -76,7 +115,7 @@ static WN_INLINE WN_DECIMAL ValCoord3D(int32 seed, int32 x, int32 y, int32 z)
   n ^= YPrime * y;
   n ^= ZPrime * z;
 
-  return (n * n * n * 60493) / WN_DECIMAL(2147483648);
+  return ValFromHash(n);
 }
 
 static WN_INLINE WN_DECIMAL ValCoord4D(int32 seed, int32 x, int32 y, int32 z, int32 w)
@@ -87,5 +126,5 @@ static WN_INLINE WN_DECIMAL ValCoord4D(int32 seed, int32 x, int32 y, int32 z, in
   n ^= ZPrime * z;
   n ^= WPrime * w;
 
-  return (n * n * n * 60493) / WN_DECIMAL(2147483648);
+  return ValFromHash(n);
 }
@@ -0,0 +1,449 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+#include "WasmNoise.Fractal.hpp"
+#endif
+
+// Single Noise Function Section *******************************
+// These functions are required for both regular and fractal cubic noise
+
+// 2D Cubic
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  int32 x1 = FastFloor(x);
+  int32 y1 = FastFloor(y);
+
+  int32 x0 = x1 - 1;
+  int32 y0 = y1 - 1;
+  int32 x2 = x1 + 1;
+  int32 y2 = y1 + 1;
+  int32 x3 = x1 + 2;
+  int32 y3 = y1 + 2;
+
+  WN_DECIMAL xs = x - static_cast<WN_DECIMAL>(x1);
+  WN_DECIMAL ys = y - static_cast<WN_DECIMAL>(y1);
+
+  return CubicLerp(
+    CubicLerp(ValCoord2DFast<Shifted>(offset, x0, y0), ValCoord2DFast<Shifted>(offset, x1, y0), ValCoord2DFast<Shifted>(offset, x2, y0), ValCoord2DFast<Shifted>(offset, x3, y0), xs),
+    CubicLerp(ValCoord2DFast<Shifted>(offset, x0, y1), ValCoord2DFast<Shifted>(offset, x1, y1), ValCoord2DFast<Shifted>(offset, x2, y1), ValCoord2DFast<Shifted>(offset, x3, y1), xs),
+    CubicLerp(ValCoord2DFast<Shifted>(offset, x0, y2), ValCoord2DFast<Shifted>(offset, x1, y2), ValCoord2DFast<Shifted>(offset, x2, y2), ValCoord2DFast<Shifted>(offset, x3, y2), xs),
+    CubicLerp(ValCoord2DFast<Shifted>(offset, x0, y3), ValCoord2DFast<Shifted>(offset, x1, y3), ValCoord2DFast<Shifted>(offset, x2, y3), ValCoord2DFast<Shifted>(offset, x3, y3), xs),
+    ys) * CUBIC_2D_BOUNDING;
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SingleCubic<true>(offset, x, y) : SingleCubic<false>(offset, x, y);
+}
+
+// 3D Cubic
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  int32 x1 = FastFloor(x);
+  int32 y1 = FastFloor(y);
+  int32 z1 = FastFloor(z);
+
+  int32 x0 = x1 - 1;
+  int32 y0 = y1 - 1;
+  int32 z0 = z1 - 1;
+  int32 x2 = x1 + 1;
+  int32 y2 = y1 + 1;
+  int32 z2 = z1 + 1;
+  int32 x3 = x1 + 2;
+  int32 y3 = y1 + 2;
+  int32 z3 = z1 + 2;
+
+  WN_DECIMAL xs = x - static_cast<WN_DECIMAL>(x1);
+  WN_DECIMAL ys = y - static_cast<WN_DECIMAL>(y1);
+  WN_DECIMAL zs = z - static_cast<WN_DECIMAL>(z1);
+
+  auto xLerp = [&](int32 cy, int32 cz)
+  {
+    return CubicLerp(ValCoord3DFast<Shifted>(offset, x0, cy, cz), ValCoord3DFast<Shifted>(offset, x1, cy, cz), ValCoord3DFast<Shifted>(offset, x2, cy, cz), ValCoord3DFast<Shifted>(offset, x3, cy, cz), xs);
+  };
+  auto yLerp = [&](int32 cz)
+  {
+    return CubicLerp(xLerp(y0, cz), xLerp(y1, cz), xLerp(y2, cz), xLerp(y3, cz), ys);
+  };
+
+  return CubicLerp(yLerp(z0), yLerp(z1), yLerp(z2), yLerp(z3), zs) * CUBIC_3D_BOUNDING;
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SingleCubic<true>(offset, x, y, z) : SingleCubic<false>(offset, x, y, z);
+}
+
+// Row kernels
+// A sample blends 4 lattice columns, each made of 4 (4x4 in 3D) lattice values. Every sample of a
+// row shares its Y (and Z) lattice coordinates, so each column is reduced along Y (and Z) once and
+// a window of 4 columns slides along the row. Stepping into the next lattice cell only reduces the
+// one new column instead of looking up all 16 (64) values again.
+
+// 2D Cubic Row
+template<bool Shifted> WN_INLINE void WasmNoise::SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const
+{
+  int32 y1 = FastFloor(y);
+  WN_DECIMAL ys = y - static_cast<WN_DECIMAL>(y1);
+
+  LatticeRow rows[4];
+  for(int32 j = 0; j < 4; j++)
+  {
+    rows[j] = RowLookup<Shifted>(offset, y1 - 1 + j);
+  }
+  auto column = [&](int32 cx)
+  {
+    return CubicLerp(ValFromIndex(RowIndex_256<Shifted>(rows[0], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[1], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[2], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[3], cx)), ys);
+  };
+
+  int32 x1 = FastFloor(x);
+  WN_DECIMAL c0 = column(x1 - 1);
+  WN_DECIMAL c1 = column(x1);
+  WN_DECIMAL c2 = column(x1 + 1);
+  WN_DECIMAL c3 = column(x1 + 2);
+
+  for(uint32 i = 0; i < length; i++)
+  {
+    WN_DECIMAL xi = x + i * xStep;
+    int32 xf = FastFloor(xi);
+    if(xf == x1 + 1)
+    {
+      c0 = c1;
+      c1 = c2;
+      c2 = c3;
+      c3 = column(xf + 2);
+      x1 = xf;
+    }
+    else if(xf != x1)
+    {
+      // Skipped over a cell, rebuild the whole window
+      c0 = column(xf - 1);
+      c1 = column(xf);
+      c2 = column(xf + 1);
+      c3 = column(xf + 2);
+      x1 = xf;
+    }
+    values[i] = CubicLerp(c0, c1, c2, c3, xi - static_cast<WN_DECIMAL>(x1)) * CUBIC_2D_BOUNDING;
+  }
+}
+
+WN_INLINE void WasmNoise::SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const
+{
+  latticeShifted ? SingleCubicRow<true>(offset, values, length, x, xStep, y) : SingleCubicRow<false>(offset, values, length, x, xStep, y);
+}
+
+// 3D Cubic Row
+template<bool Shifted> WN_INLINE void WasmNoise::SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  int32 y1 = FastFloor(y);
+  int32 z1 = FastFloor(z);
+  WN_DECIMAL ys = y - static_cast<WN_DECIMAL>(y1);
+  WN_DECIMAL zs = z - static_cast<WN_DECIMAL>(z1);
+
+  LatticeRow rows[4][4]; // [z][y]
+  for(int32 k = 0; k < 4; k++)
+  {
+    for(int32 j = 0; j < 4; j++)
+    {
+      rows[k][j] = RowLookup<Shifted>(offset, y1 - 1 + j, z1 - 1 + k);
+    }
+  }
+  auto column = [&](int32 cx)
+  {
+    WN_DECIMAL yf[4];
+    for(int32 k = 0; k < 4; k++)
+    {
+      yf[k] = CubicLerp(ValFromIndex(RowIndex_256<Shifted>(rows[k][0], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[k][1], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[k][2], cx)), ValFromIndex(RowIndex_256<Shifted>(rows[k][3], cx)), ys);
+    }
+    return CubicLerp(yf[0], yf[1], yf[2], yf[3], zs);
+  };
+
+  int32 x1 = FastFloor(x);
+  WN_DECIMAL c0 = column(x1 - 1);
+  WN_DECIMAL c1 = column(x1);
+  WN_DECIMAL c2 = column(x1 + 1);
+  WN_DECIMAL c3 = column(x1 + 2);
+
+  for(uint32 i = 0; i < length; i++)
+  {
+    WN_DECIMAL xi = x + i * xStep;
+    int32 xf = FastFloor(xi);
+    if(xf == x1 + 1)
+    {
+      c0 = c1;
+      c1 = c2;
+      c2 = c3;
+      c3 = column(xf + 2);
+      x1 = xf;
+    }
+    else if(xf != x1)
+    {
+      c0 = column(xf - 1);
+      c1 = column(xf);
+      c2 = column(xf + 1);
+      c3 = column(xf + 2);
+      x1 = xf;
+    }
+    values[i] = CubicLerp(c0, c1, c2, c3, xi - static_cast<WN_DECIMAL>(x1)) * CUBIC_3D_BOUNDING;
+  }
+}
+
+WN_INLINE void WasmNoise::SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  latticeShifted ? SingleCubicRow<true>(offset, values, length, x, xStep, y, z) : SingleCubicRow<false>(offset, values, length, x, xStep, y, z);
+}
+
+// Functionally aliases which fill in the offset parameter, allowing them to share
+// the same parameter order as the fractal functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicNoOffset(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleCubic(0, x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleCubic(0, x, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleCubicRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleCubicRow(0, values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleCubicRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleCubicRow(0, values, length, x, xStep, y, z);
+}
+
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+// 2D Cubic Fractal Functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalFBM(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SingleCubic>(), x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalBillow(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SingleCubic>(), x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SingleCubic>(), x, y);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalFBMRow(SingleRow2DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalBillowRow(SingleRow2DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalRidgedMultiRow(SingleRow2DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y);
+}
+
+// 3D Cubic Fractal Functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SingleCubic>(), x, y, z);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SingleCubic>(), x, y, z);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleCubicFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SingleCubic>(), x, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalFBMRow(SingleRow3DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalBillowRow(SingleRow3DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleCubicFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalRidgedMultiRow(SingleRow3DKernel<&WasmNoise::SingleCubicRow>(), values, length, x, xStep, y, z);
+}
+
+#endif // WN_INCLUDE_CUBIC_FRACTAL
+
+// End Single Noise Function Section *******************************
+
+// Public Cubic Noise Functions
+
+#ifdef WN_INCLUDE_CUBIC
+// 2D Single
+WN_INLINE WN_DECIMAL WasmNoise::GetCubic(WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return SingleCubic(0, x * frequency, y * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel2D<&WasmNoise::SingleCubicNoOffset>(), length, direction, startX, startY);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  return GetSquareRows(RowKernel2D<&WasmNoise::SingleCubicRowNoOffset>(), width, height, startX, startY);
+}
+
+// 3D Single
+WN_INLINE WN_DECIMAL WasmNoise::GetCubic(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return SingleCubic(0, x * frequency, y * frequency, z * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel3D<&WasmNoise::SingleCubicNoOffset>(), length, direction, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  if(plane == SquarePlane::XYPlane)
+  {
+    return GetSquareRows(RowKernel3D<&WasmNoise::SingleCubicRowNoOffset>(), width, height, startX, startY, startZ);
+  }
+  return GetSquare(Kernel3D<&WasmNoise::SingleCubicNoOffset>(), width, height, plane, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
+{
+  return GetCubeRows(RowKernel3D<&WasmNoise::SingleCubicRowNoOffset>(), width, height, depth, startX, startY, startZ);
+}
+
+#endif // WN_INCLUDE_CUBIC
+
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+// 2D Fractal
+WN_INLINE WN_DECIMAL WasmNoise::GetCubicFractal(WN_DECIMAL x, WN_DECIMAL y)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleCubicFractalFBM(x * frequency, y * frequency);
+  case FractalType::Billow:       return SingleCubicFractalBillow(x * frequency, y * frequency);
+  case FractalType::RidgedMulti:  return SingleCubicFractalRidgedMulti(x * frequency, y * frequency);
+  default:
+    ABORT();
+    return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SingleCubicFractalFBM>(), length, direction, startX, startY);
+  case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SingleCubicFractalBillow>(), length, direction, startX, startY);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SingleCubicFractalRidgedMulti>(), length, direction, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquareRows(RowKernel2D<&WasmNoise::SingleCubicFractalFBMRow>(), width, height, startX, startY);
+  case FractalType::Billow:       return GetSquareRows(RowKernel2D<&WasmNoise::SingleCubicFractalBillowRow>(), width, height, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquareRows(RowKernel2D<&WasmNoise::SingleCubicFractalRidgedMultiRow>(), width, height, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+// 3D Fractal
+WN_INLINE WN_DECIMAL WasmNoise::GetCubicFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleCubicFractalFBM(x * frequency, y * frequency, z * frequency);
+  case FractalType::Billow:       return SingleCubicFractalBillow(x * frequency, y * frequency, z * frequency);
+  case FractalType::RidgedMulti:  return SingleCubicFractalRidgedMulti(x * frequency, y * frequency, z * frequency);
+  default:
+    ABORT();
+    return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SingleCubicFractalFBM>(), length, direction, startX, startY, startZ);
+  case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SingleCubicFractalBillow>(), length, direction, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SingleCubicFractalRidgedMulti>(), length, direction, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  if(plane == SquarePlane::XYPlane)
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return GetSquareRows(RowKernel3D<&WasmNoise::SingleCubicFractalFBMRow>(), width, height, startX, startY, startZ);
+    case FractalType::Billow:       return GetSquareRows(RowKernel3D<&WasmNoise::SingleCubicFractalBillowRow>(), width, height, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetSquareRows(RowKernel3D<&WasmNoise::SingleCubicFractalRidgedMultiRow>(), width, height, startX, startY, startZ);
+    default:
+      ABORT();
+      return nullptr;
+    }
+  }
+
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SingleCubicFractalFBM>(), width, height, plane, startX, startY, startZ);
+  case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SingleCubicFractalBillow>(), width, height, plane, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SingleCubicFractalRidgedMulti>(), width, height, plane, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubicFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetCubeRows(RowKernel3D<&WasmNoise::SingleCubicFractalFBMRow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::Billow:       return GetCubeRows(RowKernel3D<&WasmNoise::SingleCubicFractalBillowRow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetCubeRows(RowKernel3D<&WasmNoise::SingleCubicFractalRidgedMultiRow>(), width, height, depth, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE uint32 *WasmNoise::GetCubicFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold)
+{
+  return GetSquareMask(Single2DKernel<&WasmNoise::SingleCubic>(), width, height, threshold, startX, startY);
+}
+
+WN_INLINE uint32 *WasmNoise::GetCubicFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold)
+{
+  return GetCubeMask(Single3DKernel<&WasmNoise::SingleCubic>(), width, height, depth, threshold, startX, startY, startZ);
+}
+
+#endif // WN_INCLUDE_CUBIC_FRACTAL
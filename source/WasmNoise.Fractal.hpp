@@ -6,6 +6,7 @@
 // Fractal Functions
 template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleFractalFBM(NoiseFunc func, Args... args)
 {
+  OctaveOrigin origin(*this);
   WN_DECIMAL sum = invoke(func, *this, perm[0], args...);
   WN_DECIMAL amp = 1;
   uint32 i = 0;
@@ -13,6 +14,7 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
   while(++i < fractalOctaves)
   {
     ((args *= fractalLacunarity), ...);
+    origin.Next();
 
     amp *= fractalGain;
     sum += invoke(func, *this, perm[i], args...) * amp;
@@ -23,6 +25,7 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
 
 template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleFractalBillow(NoiseFunc func, Args... args)
 {
+  OctaveOrigin origin(*this);
   WN_DECIMAL sum = FastAbs(invoke(func, *this, perm[0], args...)) * 2 - 1;
   WN_DECIMAL amp = 1;
   uint32 i = 0;
@@ -30,6 +33,7 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
   while(++i < fractalOctaves)
   {
     ((args *= fractalLacunarity), ...);
+    origin.Next();
 
     amp *= fractalGain;
     sum += (FastAbs(invoke(func, *this, perm[i], args...)) * 2 - 1) * amp;
@@ -40,6 +44,7 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
 
 template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleFractalRidgedMulti(NoiseFunc func, Args... args)
 {
+  OctaveOrigin origin(*this);
   WN_DECIMAL signal = 1 - FastAbs(invoke(func, *this, perm[0], args...));
   signal *= signal;
   WN_DECIMAL sum = signal * fractalExponents[0];
@@ -50,6 +55,7 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
   while(++i < fractalOctaves)
   {
     ((args *= fractalLacunarity), ...);
+    origin.Next();
 
     signal = 1 - FastAbs(invoke(func, *this, perm[i], args...));
     signal *= signal;
@@ -62,3 +68,245 @@ template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL WasmNoise::SingleF
 
   return (sum * WN_DECIMAL(1.25)) - WN_DECIMAL(1.0);
 }
+
+// Octave variants, used to build several levels of detail from a single evaluation.
+// octaveSums[i] holds the sum of octaves 0..i before any bounding/scaling is applied
+template<class NoiseFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalFBMOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL sum = invoke(func, *this, perm[0], args...);
+  WN_DECIMAL amp = 1;
+  uint32 i = 0;
+  octaveSums[0] = sum;
+
+  while(++i < fractalOctaves)
+  {
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    sum += invoke(func, *this, perm[i], args...) * amp;
+    octaveSums[i] = sum;
+  }
+}
+
+template<class NoiseFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalBillowOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL sum = FastAbs(invoke(func, *this, perm[0], args...)) * 2 - 1;
+  WN_DECIMAL amp = 1;
+  uint32 i = 0;
+  octaveSums[0] = sum;
+
+  while(++i < fractalOctaves)
+  {
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    sum += (FastAbs(invoke(func, *this, perm[i], args...)) * 2 - 1) * amp;
+    octaveSums[i] = sum;
+  }
+}
+
+template<class NoiseFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalRidgedMultiOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL signal = 1 - FastAbs(invoke(func, *this, perm[0], args...));
+  signal *= signal;
+  WN_DECIMAL sum = signal * fractalExponents[0];
+  WN_DECIMAL weight = signal * fractalGain;
+  Clamp(weight, 0.0, 1.0);
+  uint32 i = 0; 
+  octaveSums[0] = sum;
+
+  while(++i < fractalOctaves)
+  {
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    signal = 1 - FastAbs(invoke(func, *this, perm[i], args...));
+    signal *= signal;
+    signal *= weight;
+    weight = signal * fractalGain;
+    Clamp(weight, 0.0, 1.0);
+
+    sum += (signal * fractalExponents[i]);
+    octaveSums[i] = sum;
+  }
+}
+
+// Threshold variants, every octave lies within [-1, 1] so once the running sum is further from the
+// threshold than all the remaining octaves' amplitudes could move it, the answer is known and the 
+// rest of the octaves are skipped. Sums are compared before bounding, threshold is scaled to match
+template<class NoiseFunc, class... Args> WN_INLINE bool WasmNoise::SingleFractalAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleFractalFBMAbove(func, threshold, args...);
+  case FractalType::Billow:       return SingleFractalBillowAbove(func, threshold, args...);
+  // Ridged multi octaves are weighted by the previous octave, so there's no cheap bound
+  case FractalType::RidgedMulti:  return SingleFractalRidgedMulti(func, args...) > threshold;
+  default:
+    ABORT();
+    return false;
+  }
+}
+
+template<class NoiseFunc, class... Args> WN_INLINE bool WasmNoise::SingleFractalFBMAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args)
+{
+  OctaveOrigin origin(*this);
+  threshold /= fractalBounding;
+  WN_DECIMAL sum = invoke(func, *this, perm[0], args...);
+  WN_DECIMAL amp = 1;
+  WN_DECIMAL ampLeft = 1 / fractalBounding - 1;
+  uint32 i = 0;
+
+  while(++i < fractalOctaves)
+  {
+    if(sum - ampLeft > threshold) return true;
+    if(sum + ampLeft <= threshold) return false;
+
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    ampLeft -= amp;
+    sum += invoke(func, *this, perm[i], args...) * amp;
+  }
+
+  return sum > threshold;
+}
+
+template<class NoiseFunc, class... Args> WN_INLINE bool WasmNoise::SingleFractalBillowAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args)
+{
+  OctaveOrigin origin(*this);
+  threshold /= fractalBounding;
+  WN_DECIMAL sum = FastAbs(invoke(func, *this, perm[0], args...)) * 2 - 1;
+  WN_DECIMAL amp = 1;
+  WN_DECIMAL ampLeft = 1 / fractalBounding - 1;
+  uint32 i = 0;
+
+  while(++i < fractalOctaves)
+  {
+    if(sum - ampLeft > threshold) return true;
+    if(sum + ampLeft <= threshold) return false;
+
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    ampLeft -= amp;
+    sum += (FastAbs(invoke(func, *this, perm[i], args...)) * 2 - 1) * amp;
+  }
+
+  return sum > threshold;
+}
+
+#if defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+// Row variants, the row kernel fills a whole run of samples per octave which are then combined
+// per sample exactly like the single sample versions above. length must be <= RowChunkLength
+template<class RowFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalFBMRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL octave[RowChunkLength];
+  invoke(func, *this, perm[0], values, length, x, xStep, args...);
+  WN_DECIMAL amp = 1;
+  uint32 i = 0;
+
+  while(++i < fractalOctaves)
+  {
+    x *= fractalLacunarity;
+    xStep *= fractalLacunarity;
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    invoke(func, *this, perm[i], octave, length, x, xStep, args...);
+    for(uint32 j = 0; j < length; j++)
+    {
+      values[j] += octave[j] * amp;
+    }
+  }
+
+  for(uint32 j = 0; j < length; j++)
+  {
+    values[j] *= fractalBounding;
+  }
+}
+
+template<class RowFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalBillowRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL octave[RowChunkLength];
+  invoke(func, *this, perm[0], values, length, x, xStep, args...);
+  for(uint32 j = 0; j < length; j++)
+  {
+    values[j] = FastAbs(values[j]) * 2 - 1;
+  }
+  WN_DECIMAL amp = 1;
+  uint32 i = 0;
+
+  while(++i < fractalOctaves)
+  {
+    x *= fractalLacunarity;
+    xStep *= fractalLacunarity;
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    amp *= fractalGain;
+    invoke(func, *this, perm[i], octave, length, x, xStep, args...);
+    for(uint32 j = 0; j < length; j++)
+    {
+      values[j] += (FastAbs(octave[j]) * 2 - 1) * amp;
+    }
+  }
+
+  for(uint32 j = 0; j < length; j++)
+  {
+    values[j] *= fractalBounding;
+  }
+}
+
+template<class RowFunc, class... Args> WN_INLINE void WasmNoise::SingleFractalRidgedMultiRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL octave[RowChunkLength];
+  WN_DECIMAL weight[RowChunkLength];
+  invoke(func, *this, perm[0], values, length, x, xStep, args...);
+  for(uint32 j = 0; j < length; j++)
+  {
+    WN_DECIMAL signal = 1 - FastAbs(values[j]);
+    signal *= signal;
+    values[j] = signal * fractalExponents[0];
+    weight[j] = signal * fractalGain;
+    Clamp(weight[j], 0.0, 1.0);
+  }
+  uint32 i = 0;
+
+  while(++i < fractalOctaves)
+  {
+    x *= fractalLacunarity;
+    xStep *= fractalLacunarity;
+    ((args *= fractalLacunarity), ...);
+    origin.Next();
+
+    invoke(func, *this, perm[i], octave, length, x, xStep, args...);
+    for(uint32 j = 0; j < length; j++)
+    {
+      WN_DECIMAL signal = 1 - FastAbs(octave[j]);
+      signal *= signal;
+      signal *= weight[j];
+      weight[j] = signal * fractalGain;
+      Clamp(weight[j], 0.0, 1.0);
+
+      values[j] += (signal * fractalExponents[i]);
+    }
+  }
+
+  for(uint32 j = 0; j < length; j++)
+  {
+    values[j] = (values[j] * WN_DECIMAL(1.25)) - WN_DECIMAL(1.0);
+  }
+}
+#endif // WN_INCLUDE_VALUE_FRACTAL || WN_INCLUDE_CUBIC_FRACTAL
@@ -0,0 +1,226 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+#include "invoke.hpp"
+
+// Graphs are evaluated GraphChunkLength samples at a time, node by node. Every node writes its chunk 
+// into its own slot of the scratch buffer and reads its inputs from the slots of earlier nodes, so 
+// the intermediate layers stay in cache and only the output node's values reach the returned array.
+// Constant slots are filled once when the graph is compiled.
+
+bool WasmNoise::SetGraph(const WN_DECIMAL *nodes, uint32 nodeCount)
+{
+  ClearGraph();
+  if(nodes == nullptr || nodeCount == 0)
+  {
+    ABORT();
+    return false;
+  }
+
+  GraphNode *compiled = new GraphNode[nodeCount];
+  for(uint32 n = 0; n < nodeCount; n++)
+  {
+    const WN_DECIMAL *record = nodes + (GraphRecordLength * n);
+    GraphNode &node = compiled[n];
+    node.op = static_cast<GraphOp>(static_cast<int32>(record[0]));
+    // Negative indices wrap around to large ones and fail the checks below
+    node.input0 = static_cast<uint32>(static_cast<int32>(record[1]));
+    node.input1 = static_cast<uint32>(static_cast<int32>(record[2]));
+    node.input2 = static_cast<uint32>(static_cast<int32>(record[3]));
+    node.noiseType = static_cast<NoiseType>(static_cast<int32>(record[1]));
+    node.func = nullptr;
+    node.value = record[1];
+    node.frequencyScale = record[2];
+    node.offset = record[3];
+
+    bool valid;
+    switch(node.op)
+    {
+    case GraphOp::Source:
+      valid = GetNoiseFunc<FPtr2D>(node.noiseType) != nullptr;
+      break;
+    case GraphOp::Constant:
+      valid = true;
+      break;
+    case GraphOp::Add:
+    case GraphOp::Multiply:
+    case GraphOp::Min:
+    case GraphOp::Max:
+      valid = node.input0 < n && node.input1 < n;
+      break;
+    case GraphOp::Clamp:
+    case GraphOp::Select:
+      valid = node.input0 < n && node.input1 < n && node.input2 < n;
+      break;
+    default:
+      valid = false;
+      break;
+    }
+
+    if(!valid)
+    {
+      delete[] compiled;
+      ABORT();
+      return false;
+    }
+  }
+
+  graphNodes = compiled;
+  graphNodeCount = nodeCount;
+  graphScratch = new WN_DECIMAL[nodeCount * GraphChunkLength];
+  for(uint32 n = 0; n < nodeCount; n++)
+  {
+    if(graphNodes[n].op == GraphOp::Constant)
+    {
+      WN_DECIMAL *out = graphScratch + (GraphChunkLength * n);
+      for(uint32 i = 0; i < GraphChunkLength; i++)
+      {
+        out[i] = graphNodes[n].value;
+      }
+    }
+  }
+  return true;
+}
+
+void WasmNoise::ClearGraph()
+{
+  if(graphNodes) delete[] graphNodes;
+  if(graphScratch) delete[] graphScratch;
+  graphNodes = nullptr;
+  graphScratch = nullptr;
+  graphNodeCount = 0;
+}
+
+void WasmNoise::UpdateGraphSources()
+{
+  for(uint32 n = 0; n < graphNodeCount; n++)
+  {
+    if(graphNodes[n].op == GraphOp::Source)
+    {
+      graphNodes[n].func = GetNoiseFunc<FPtr2D>(graphNodes[n].noiseType);
+    }
+  }
+}
+
+WN_DECIMAL *WasmNoise::EvaluateGraph(const WN_DECIMAL *xs, const WN_DECIMAL *ys, uint32 length)
+{
+  for(uint32 n = 0; n < graphNodeCount; n++)
+  {
+    const GraphNode &node = graphNodes[n];
+    WN_DECIMAL *out = graphScratch + (GraphChunkLength * n);
+    const WN_DECIMAL *a = graphScratch + (GraphChunkLength * node.input0);
+    const WN_DECIMAL *b = graphScratch + (GraphChunkLength * node.input1);
+    const WN_DECIMAL *c = graphScratch + (GraphChunkLength * node.input2);
+    switch(node.op)
+    {
+    case GraphOp::Source:
+      for(uint32 i = 0; i < length; i++)
+      {
+        out[i] = invoke(node.func, *this, xs[i] * node.frequencyScale + node.offset, ys[i] * node.frequencyScale + node.offset);
+      }
+      break;
+    case GraphOp::Add:
+      for(uint32 i = 0; i < length; i++) out[i] = a[i] + b[i];
+      break;
+    case GraphOp::Multiply:
+      for(uint32 i = 0; i < length; i++) out[i] = a[i] * b[i];
+      break;
+    case GraphOp::Min:
+      for(uint32 i = 0; i < length; i++) out[i] = min(a[i], b[i]);
+      break;
+    case GraphOp::Max:
+      for(uint32 i = 0; i < length; i++) out[i] = max(a[i], b[i]);
+      break;
+    case GraphOp::Clamp:
+      for(uint32 i = 0; i < length; i++) out[i] = max(b[i], min(a[i], c[i]));
+      break;
+    case GraphOp::Select:
+      for(uint32 i = 0; i < length; i++) out[i] = (c[i] <= 0) ? a[i] : b[i];
+      break;
+    default: // Constants are filled when compiled
+      break;
+    }
+  }
+  return graphScratch + (GraphChunkLength * (graphNodeCount - 1));
+}
+
+// Public Graph Functions
+WN_DECIMAL WasmNoise::GetGraph(WN_DECIMAL x, WN_DECIMAL y)
+{
+  if(graphNodes == nullptr)
+  {
+    ABORT();
+    return 0;
+  }
+
+  UpdateGraphSources();
+  WN_DECIMAL xs[] = { x * frequency };
+  WN_DECIMAL ys[] = { y * frequency };
+  return EvaluateGraph(xs, ys, 1)[0];
+}
+
+WN_DECIMAL *WasmNoise::GetGraphStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  if(graphNodes == nullptr || (direction != StripDirection::XAxis && direction != StripDirection::YAxis))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  UpdateGraphSources();
+  WN_DECIMAL *values = returnHelper.NewArray(length);
+  WN_DECIMAL xs[GraphChunkLength];
+  WN_DECIMAL ys[GraphChunkLength];
+  bool alongX = direction == StripDirection::XAxis;
+  for(uint32 s = 0; s < length; s += GraphChunkLength)
+  {
+    uint32 chunkLength = min(length - s, GraphChunkLength);
+    for(uint32 i = 0; i < chunkLength; i++)
+    {
+      xs[i] = (startX + (alongX ? (s+i)*sampleStepX : 0)) * frequency;
+      ys[i] = (startY + (alongX ? 0 : (s+i)*sampleStepY)) * frequency;
+    }
+
+    WN_DECIMAL *out = EvaluateGraph(xs, ys, chunkLength);
+    for(uint32 i = 0; i < chunkLength; i++)
+    {
+      values[s+i] = Remap(out[i]);
+    }
+  }
+  return values;
+}
+
+WN_DECIMAL *WasmNoise::GetGraphSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  if(graphNodes == nullptr || !IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  UpdateGraphSources();
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  WN_DECIMAL xs[GraphChunkLength];
+  WN_DECIMAL ys[GraphChunkLength];
+  for(uint32 y = 0; y < height; y++)
+  {
+    uint32 rowOffset = LayoutOffset(1, y, width, height, 1);
+    WN_DECIMAL yCoord = (startY + y*sampleStepY) * frequency;
+    for(uint32 x = 0; x < width; x += GraphChunkLength)
+    {
+      uint32 chunkLength = min(width - x, GraphChunkLength);
+      for(uint32 i = 0; i < chunkLength; i++)
+      {
+        xs[i] = (startX + (x+i)*sampleStepX) * frequency;
+        ys[i] = yCoord;
+      }
+
+      WN_DECIMAL *out = EvaluateGraph(xs, ys, chunkLength);
+      for(uint32 i = 0; i < chunkLength; i++)
+      {
+        values[rowOffset + LayoutOffset(0, x+i, width, height, 1)] = Remap(out[i]);
+      }
+    }
+  }
+  return values;
+}
@@ -0,0 +1,378 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+#include "invoke.hpp"
+
+// Marching cubes over a grid of samples, one layer of cells at a time. The samples are kept in a ring
+// of four slabs (the layer's two planes plus one either side for the gradients), each with a one
+// sample apron around it, so normals are central differences everywhere, including the grid's edges.
+// Every grid edge the surface crosses gets a single vertex, which all the cells sharing that edge
+// index, so the mesh comes out welded.
+//
+// Corner i of a cell sits at (i & 1, (i >> 1) & 1, i >> 2). Edges 0-3 run along X, 4-7 along Y and
+// 8-11 along Z, in the order of MESH_EDGE_CORNERS.
+
+const uint8 MESH_EDGE_CORNERS[12][2] =
+{
+  { 0, 1 }, { 2, 3 }, { 4, 5 }, { 6, 7 },
+  { 0, 2 }, { 1, 3 }, { 4, 6 }, { 5, 7 },
+  { 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+};
+
+// The triangle table is traced from the cell faces rather than written out by hand. On each face the
+// crossed edges are paired up so the surface cuts off every corner below the iso level separately
+// (this decides the ambiguous faces the same way for both cells sharing the face, so the mesh has no
+// holes), and the segments are directed with the below side on their left seen from outside the
+// cell. The segments then chain into loops around the cell, which are split into triangle fans. The
+// fan starts from a vertex that leaves no triangle lying flat in a cell face, where the neighbouring
+// cell could emit the same triangle back to back with it.
+// Triangles wind counter-clockwise seen from the side below the iso level.
+void WasmNoise::BuildMeshTables()
+{
+  int32 edgeIndex[8][8];
+  for(uint32 e = 0; e < 12; e++)
+  {
+    edgeIndex[MESH_EDGE_CORNERS[e][0]][MESH_EDGE_CORNERS[e][1]] = e;
+    edgeIndex[MESH_EDGE_CORNERS[e][1]][MESH_EDGE_CORNERS[e][0]] = e;
+  }
+
+  // Bit axis * 2 + side for each of the two faces an edge lies in
+  uint32 edgeFaces[12];
+  for(uint32 e = 0; e < 12; e++)
+  {
+    edgeFaces[e] = 0;
+    for(uint32 axis = 0; axis < 3; axis++)
+    {
+      uint32 side = (MESH_EDGE_CORNERS[e][0] >> axis) & 1;
+      if(side == ((MESH_EDGE_CORNERS[e][1] >> axis) & 1))
+      {
+        edgeFaces[e] |= 1 << (axis * 2 + side);
+      }
+    }
+  }
+
+  // Face corners counter-clockwise seen from outside the cell
+  uint32 faces[6][4];
+  for(uint32 axis = 0; axis < 3; axis++)
+  {
+    uint32 u = (axis + 1) % 3;
+    uint32 v = (axis + 2) % 3;
+    const uint32 square[4][2] = { { 0, 0 }, { 1, 0 }, { 1, 1 }, { 0, 1 } };
+    for(uint32 side = 0; side < 2; side++)
+    {
+      for(uint32 k = 0; k < 4; k++)
+      {
+        uint32 corner = (side << axis) | (square[k][0] << u) | (square[k][1] << v);
+        faces[axis * 2 + side][side == 1 ? k : 3 - k] = corner;
+      }
+    }
+  }
+
+  for(uint32 c = 0; c < 256; c++)
+  {
+    int32 next[12];
+    for(uint32 e = 0; e < 12; e++)
+    {
+      next[e] = -1;
+    }
+
+    for(uint32 f = 0; f < 6; f++)
+    {
+      const uint32 *corners = faces[f];
+      for(uint32 k = 0; k < 4; k++)
+      {
+        // Walking into the below region, pair with the next crossing which walks back out
+        bool enters = !(c & (1 << corners[k])) && (c & (1 << corners[(k + 1) & 3]));
+        if(!enters)
+        {
+          continue;
+        }
+        uint32 m = (k + 1) & 3;
+        while(((c >> corners[m]) & 1) == ((c >> corners[(m + 1) & 3]) & 1))
+        {
+          m = (m + 1) & 3;
+        }
+        next[edgeIndex[corners[m]][corners[(m + 1) & 3]]] = edgeIndex[corners[k]][corners[(k + 1) & 3]];
+      }
+    }
+
+    bool traced[12] = { false };
+    uint32 length = 0;
+    for(uint32 e = 0; e < 12; e++)
+    {
+      if(next[e] < 0 || traced[e])
+      {
+        continue;
+      }
+      int32 loop[12];
+      uint32 loopLength = 0;
+      for(int32 p = e; !traced[p]; p = next[p])
+      {
+        traced[p] = true;
+        loop[loopLength++] = p;
+      }
+
+      uint32 apex = 0;
+      for(uint32 start = 0; start < loopLength; start++)
+      {
+        bool flat = false;
+        for(uint32 i = 1; i + 1 < loopLength; i++)
+        {
+          flat |= (edgeFaces[loop[start]] & edgeFaces[loop[(start + i) % loopLength]] & edgeFaces[loop[(start + i + 1) % loopLength]]) != 0;
+        }
+        if(!flat)
+        {
+          apex = start;
+          break;
+        }
+      }
+      for(uint32 i = 1; i + 1 < loopLength; i++)
+      {
+        meshTriangles[c][length++] = static_cast<int8>(loop[apex]);
+        meshTriangles[c][length++] = static_cast<int8>(loop[(apex + i) % loopLength]);
+        meshTriangles[c][length++] = static_cast<int8>(loop[(apex + i + 1) % loopLength]);
+      }
+    }
+    meshTriangles[c][length] = -1;
+  }
+}
+
+// Returns the index of the vertex where the surface crosses the edge from sample (x, y, z) along axis
+WN_INLINE uint32 WasmNoise::AddMeshVertex(const MeshVolume &volume, int32 x, int32 y, int32 z, uint32 axis)
+{
+  const int32 dx = (axis == 0) ? 1 : 0;
+  const int32 dy = (axis == 1) ? 1 : 0;
+  const int32 dz = (axis == 2) ? 1 : 0;
+  WN_DECIMAL a = volume.Value(x, y, z);
+  WN_DECIMAL b = volume.Value(x + dx, y + dy, z + dz);
+  WN_DECIMAL t = (volume.isoLevel - a) / (b - a);
+
+  if(meshVertexCount == meshVertexCapacity)
+  {
+    meshVertices = GrowMeshBuffer(meshVertices, meshVertexCount * MeshVertexStride, meshVertexCapacity, MeshVertexStride);
+  }
+  WN_DECIMAL *vertex = meshVertices + (meshVertexCount * MeshVertexStride);
+  vertex[0] = volume.origin[0] + (x + dx*t) * volume.step[0];
+  vertex[1] = volume.origin[1] + (y + dy*t) * volume.step[1];
+  vertex[2] = volume.origin[2] + (z + dz*t) * volume.step[2];
+
+  // Normals point down the gradient, to the side below the iso level
+  WN_DECIMAL normal[3];
+  for(uint32 i = 0; i < 3; i++)
+  {
+    int32 ox = (i == 0) ? 1 : 0;
+    int32 oy = (i == 1) ? 1 : 0;
+    int32 oz = (i == 2) ? 1 : 0;
+    WN_DECIMAL gradientA = volume.Value(x + ox, y + oy, z + oz) - volume.Value(x - ox, y - oy, z - oz);
+    WN_DECIMAL gradientB = volume.Value(x + dx + ox, y + dy + oy, z + dz + oz) - volume.Value(x + dx - ox, y + dy - oy, z + dz - oz);
+    normal[i] = -Lerp(gradientA, gradientB, t) / volume.step[i];
+  }
+  WN_DECIMAL lengthSquared = normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2];
+  if(lengthSquared == 0)
+  {
+    // Flat differences around the edge, fall back to the edge's own direction
+    normal[axis] = (b > a) ? -1 : 1;
+    lengthSquared = 1;
+  }
+  // The builtin compiles to the sqrt instruction, there's no libm to link
+  WN_DECIMAL scale = 1 / static_cast<WN_DECIMAL>(__builtin_sqrt(lengthSquared));
+  vertex[3] = normal[0] * scale;
+  vertex[4] = normal[1] * scale;
+  vertex[5] = normal[2] * scale;
+
+  return meshVertexCount++;
+}
+
+// Vertices for the X and Y edges of plane z
+WN_INLINE void WasmNoise::AddMeshPlaneVertices(const MeshVolume &volume, int32 z, uint32 *edgesX, uint32 *edgesY)
+{
+  for(int32 y = 0; y < volume.height; y++)
+  {
+    for(int32 x = 0; x < volume.width; x++)
+    {
+      bool below = volume.Value(x, y, z) < volume.isoLevel;
+      if(x + 1 < volume.width && below != (volume.Value(x + 1, y, z) < volume.isoLevel))
+      {
+        edgesX[y * (volume.width - 1) + x] = AddMeshVertex(volume, x, y, z, 0);
+      }
+      if(y + 1 < volume.height && below != (volume.Value(x, y + 1, z) < volume.isoLevel))
+      {
+        edgesY[y * volume.width + x] = AddMeshVertex(volume, x, y, z, 1);
+      }
+    }
+  }
+}
+
+template<class SlabFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetMesh(SlabFunc fillSlab, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel, const WN_DECIMAL *origin, const WN_DECIMAL *step)
+{
+  meshVertexCount = 0;
+  meshIndexCount = 0;
+  if(width < 2 || height < 2 || depth < 2)
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  MeshVolume volume;
+  volume.width = static_cast<int32>(width);
+  volume.height = static_cast<int32>(height);
+  volume.pitch = width + 2;
+  volume.slabSize = (width + 2) * (height + 2);
+  volume.slabs = meshSlabHelper.NewArray(4 * volume.slabSize);
+  volume.isoLevel = isoLevel;
+  for(uint32 i = 0; i < 3; i++)
+  {
+    volume.origin[i] = origin[i];
+    volume.step[i] = step[i];
+  }
+
+  // Vertex indices of the crossed edges: X and Y edges of the layer's bottom and top planes (by plane
+  // parity) and the Z edges between them. Only crossed edges are ever written or read
+  uint32 planeXSize = (width - 1) * height;
+  uint32 planeYSize = width * (height - 1);
+  uint32 *edges = meshEdgeHelper.NewArray(2*planeXSize + 2*planeYSize + width*height);
+  uint32 *edgesX[2] = { edges, edges + planeXSize };
+  uint32 *edgesY[2] = { edges + 2*planeXSize, edges + 2*planeXSize + planeYSize };
+  uint32 *edgesZ = edges + 2*planeXSize + 2*planeYSize;
+
+  for(int32 z = -1; z <= 1; z++)
+  {
+    fillSlab(z, volume.Slab(z));
+  }
+  AddMeshPlaneVertices(volume, 0, edgesX[0], edgesY[0]);
+
+  for(int32 z = 0; z + 1 < static_cast<int32>(depth); z++)
+  {
+    fillSlab(z + 2, volume.Slab(z + 2));
+    uint32 bottom = z & 1;
+    uint32 top = bottom ^ 1;
+    AddMeshPlaneVertices(volume, z + 1, edgesX[top], edgesY[top]);
+    for(int32 y = 0; y < volume.height; y++)
+    {
+      for(int32 x = 0; x < volume.width; x++)
+      {
+        if((volume.Value(x, y, z) < isoLevel) != (volume.Value(x, y, z + 1) < isoLevel))
+        {
+          edgesZ[y * volume.width + x] = AddMeshVertex(volume, x, y, z, 2);
+        }
+      }
+    }
+
+    for(int32 y = 0; y + 1 < volume.height; y++)
+    {
+      // Each edge's vertex indices for this row of cells, offset by x
+      const uint32 *rowEdges[12] =
+      {
+        edgesX[bottom] + y * (volume.width - 1), edgesX[bottom] + (y + 1) * (volume.width - 1),
+        edgesX[top] + y * (volume.width - 1),    edgesX[top] + (y + 1) * (volume.width - 1),
+        edgesY[bottom] + y * volume.width,       edgesY[bottom] + y * volume.width + 1,
+        edgesY[top] + y * volume.width,          edgesY[top] + y * volume.width + 1,
+        edgesZ + y * volume.width,               edgesZ + y * volume.width + 1,
+        edgesZ + (y + 1) * volume.width,         edgesZ + (y + 1) * volume.width + 1
+      };
+      const WN_DECIMAL *rows[4] =
+      {
+        volume.Slab(z) + (y + 1) * volume.pitch + 1,     volume.Slab(z) + (y + 2) * volume.pitch + 1,
+        volume.Slab(z + 1) + (y + 1) * volume.pitch + 1, volume.Slab(z + 1) + (y + 2) * volume.pitch + 1
+      };
+
+      for(int32 x = 0; x + 1 < volume.width; x++)
+      {
+        uint32 cell = 0;
+        for(uint32 corner = 0; corner < 8; corner++)
+        {
+          cell |= (rows[corner >> 1][x + (corner & 1)] < isoLevel) ? (1 << corner) : 0;
+        }
+        if(cell == 0 || cell == 255)
+        {
+          continue;
+        }
+
+        if(meshIndexCount + MeshCaseLength > meshIndexCapacity)
+        {
+          meshIndices = GrowMeshBuffer(meshIndices, meshIndexCount, meshIndexCapacity, 1);
+        }
+        for(const int8 *edge = meshTriangles[cell]; *edge >= 0; edge++)
+        {
+          meshIndices[meshIndexCount++] = rowEdges[*edge][x];
+        }
+      }
+    }
+  }
+  return meshVertices;
+}
+
+// Doubles a mesh buffer's capacity (counted in records of recordLength values), keeping its first count values
+template<class T>
+T *WasmNoise::GrowMeshBuffer(T *buffer, uint32 count, uint32 &capacity, uint32 recordLength)
+{
+  capacity = max(capacity * 2, MeshInitialCapacity);
+  T *grown = new T[capacity * recordLength];
+  for(uint32 i = 0; i < count; i++)
+  {
+    grown[i] = buffer[i];
+  }
+  if(buffer != nullptr)
+  {
+    delete[] buffer;
+  }
+  return grown;
+}
+
+WN_DECIMAL *WasmNoise::GetIsoSurface(NoiseType noiseType, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel)
+{
+  FPtr3D func = GetNoiseFunc<FPtr3D>(noiseType);
+  if(func == nullptr)
+  {
+    ABORT();
+    meshVertexCount = 0;
+    meshIndexCount = 0;
+    return nullptr;
+  }
+
+  // Slabs cover samples -1 to width along X and -1 to height along Y
+  auto fillSlab = [&](int32 z, WN_DECIMAL *slab)
+  {
+    WN_DECIMAL zf = (startZ + z*sampleStepZ) * frequency;
+    for(int32 y = -1; y <= static_cast<int32>(height); y++)
+    {
+      WN_DECIMAL yf = (startY + y*sampleStepY) * frequency;
+      for(int32 x = -1; x <= static_cast<int32>(width); x++)
+      {
+        *slab++ = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, yf, zf));
+      }
+    }
+  };
+  const WN_DECIMAL origin[3] = { startX, startY, startZ };
+  const WN_DECIMAL step[3] = { sampleStepX, sampleStepY, sampleStepZ };
+  return GetMesh(fillSlab, width, height, depth, isoLevel, origin, step);
+}
+
+WN_DECIMAL *WasmNoise::GetIsoSurfaceFromCube(const WN_DECIMAL *values, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel)
+{
+  if(values == nullptr)
+  {
+    ABORT();
+    meshVertexCount = 0;
+    meshIndexCount = 0;
+    return nullptr;
+  }
+
+  // The apron repeats the cube's outer samples, giving one-sided differences at its faces
+  auto fillSlab = [&](int32 z, WN_DECIMAL *slab)
+  {
+    const WN_DECIMAL *plane = values + min(max(z, 0), static_cast<int32>(depth) - 1) * width * height;
+    for(int32 y = -1; y <= static_cast<int32>(height); y++)
+    {
+      const WN_DECIMAL *row = plane + min(max(y, 0), static_cast<int32>(height) - 1) * width;
+      for(int32 x = -1; x <= static_cast<int32>(width); x++)
+      {
+        *slab++ = row[min(max(x, 0), static_cast<int32>(width) - 1)];
+      }
+    }
+  };
+  const WN_DECIMAL origin[3] = { 0, 0, 0 };
+  const WN_DECIMAL step[3] = { 1, 1, 1 };
+  return GetMesh(fillSlab, width, height, depth, isoLevel, origin, step);
+}
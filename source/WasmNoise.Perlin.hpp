@@ -9,7 +9,7 @@
 // These functions are required for both regular and fractal perlin noise
 
 // 2D Perlin
-WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
 {
   int32 x0 = FastFloor(x);
   int32 y0 = FastFloor(y);
@@ -38,14 +38,19 @@ WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECI
   WN_DECIMAL xd1 = xd0 - 1;
   WN_DECIMAL yd1 = yd0 - 1;
 
-  WN_DECIMAL xf0 = Lerp(GradCoord2D(offset, x0, y0, xd0, yd0), GradCoord2D(offset, x1, y0, xd1, yd0), xs);
-  WN_DECIMAL xf1 = Lerp(GradCoord2D(offset, x0, y1, xd0, yd1), GradCoord2D(offset, x1, y1, xd1, yd1), xs);
+  WN_DECIMAL xf0 = Lerp(GradCoord2D<Shifted>(offset, x0, y0, xd0, yd0), GradCoord2D<Shifted>(offset, x1, y0, xd1, yd0), xs);
+  WN_DECIMAL xf1 = Lerp(GradCoord2D<Shifted>(offset, x0, y1, xd0, yd1), GradCoord2D<Shifted>(offset, x1, y1, xd1, yd1), xs);
 
   return Lerp(xf0, xf1, ys);
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SinglePerlin<true>(offset, x, y) : SinglePerlin<false>(offset, x, y);
+}
+
 // 3D Perlin
-WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
 {
   int32 x0 = FastFloor(x);
   int32 y0 = FastFloor(y);
@@ -81,10 +86,10 @@ WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECI
   WN_DECIMAL yd1 = yd0 - 1;
   WN_DECIMAL zd1 = zd0 - 1;
 
-  WN_DECIMAL xf00 = Lerp(GradCoord3D(offset, x0, y0, z0, xd0, yd0, zd0), GradCoord3D(offset, x1, y0, z0, xd1, yd0, zd0), xs);
-  WN_DECIMAL xf10 = Lerp(GradCoord3D(offset, x0, y1, z0, xd0, yd1, zd0), GradCoord3D(offset, x1, y1, z0, xd1, yd1, zd0), xs);
-  WN_DECIMAL xf01 = Lerp(GradCoord3D(offset, x0, y0, z1, xd0, yd0, zd1), GradCoord3D(offset, x1, y0, z1, xd1, yd0, zd1), xs);
-  WN_DECIMAL xf11 = Lerp(GradCoord3D(offset, x0, y1, z1, xd0, yd1, zd1), GradCoord3D(offset, x1, y1, z1, xd1, yd1, zd1), xs);
+  WN_DECIMAL xf00 = Lerp(GradCoord3D<Shifted>(offset, x0, y0, z0, xd0, yd0, zd0), GradCoord3D<Shifted>(offset, x1, y0, z0, xd1, yd0, zd0), xs);
+  WN_DECIMAL xf10 = Lerp(GradCoord3D<Shifted>(offset, x0, y1, z0, xd0, yd1, zd0), GradCoord3D<Shifted>(offset, x1, y1, z0, xd1, yd1, zd0), xs);
+  WN_DECIMAL xf01 = Lerp(GradCoord3D<Shifted>(offset, x0, y0, z1, xd0, yd0, zd1), GradCoord3D<Shifted>(offset, x1, y0, z1, xd1, yd0, zd1), xs);
+  WN_DECIMAL xf11 = Lerp(GradCoord3D<Shifted>(offset, x0, y1, z1, xd0, yd1, zd1), GradCoord3D<Shifted>(offset, x1, y1, z1, xd1, yd1, zd1), xs);
 
   WN_DECIMAL yf0 = Lerp(xf00, xf10, ys);
   WN_DECIMAL yf1 = Lerp(xf01, xf11, ys);
@@ -92,6 +97,11 @@ WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECI
   return Lerp(yf0, yf1, zs);
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SinglePerlin<true>(offset, x, y, z) : SinglePerlin<false>(offset, x, y, z);
+}
+
 // Functionally aliases which fill in the offset parameter, allowing them to share
 // the same parameter order as the fractal functions
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinNoOffset(WN_DECIMAL x, WN_DECIMAL y)
@@ -108,33 +118,48 @@ WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinNoOffset(WN_DECIMAL x, WN_DECIMAL y,
 // 2D Perlin Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalFBM(WN_DECIMAL x, WN_DECIMAL y) 
 {
-  return SingleFractalFBM<Single2DFPtr>(&WasmNoise::SinglePerlin, x, y);
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SinglePerlin>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalBillow(WN_DECIMAL x, WN_DECIMAL y) 
 {
-  return SingleFractalBillow<Single2DFPtr>(&WasmNoise::SinglePerlin, x, y);
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SinglePerlin>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y) 
 {
-  return SingleFractalRidgedMulti<Single2DFPtr>(&WasmNoise::SinglePerlin, x, y);
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SinglePerlin>(), x, y);
+}
+
+WN_INLINE void WasmNoise::SinglePerlinFractalFBMOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalFBMOctaves(Single2DKernel<&WasmNoise::SinglePerlin>(), octaveSums, x, y);
+}
+
+WN_INLINE void WasmNoise::SinglePerlinFractalBillowOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalBillowOctaves(Single2DKernel<&WasmNoise::SinglePerlin>(), octaveSums, x, y);
+}
+
+WN_INLINE void WasmNoise::SinglePerlinFractalRidgedMultiOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalRidgedMultiOctaves(Single2DKernel<&WasmNoise::SinglePerlin>(), octaveSums, x, y);
 }
 
 // 3D Perlin Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalFBM<Single3DFPtr>(&WasmNoise::SinglePerlin, x, y, z);
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SinglePerlin>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalBillow<Single3DFPtr>(&WasmNoise::SinglePerlin, x, y, z);  
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SinglePerlin>(), x, y, z);  
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SinglePerlinFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalRidgedMulti<Single3DFPtr>(&WasmNoise::SinglePerlin, x, y, z);
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SinglePerlin>(), x, y, z);
 }
 #endif // WN_INCLUDE_PERLIN_FRACTAL
 
@@ -151,12 +176,12 @@ WN_INLINE WN_DECIMAL WasmNoise::GetPerlin(WN_DECIMAL x, WN_DECIMAL y) const
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
 {
-  return GetStrip<>(&WasmNoise::SinglePerlinNoOffset, length, direction, startX, startY);
+  return GetStrip(Kernel2D<&WasmNoise::SinglePerlinNoOffset>(), length, direction, startX, startY);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)  
 {  
-  return GetSquare<>(&WasmNoise::SinglePerlinNoOffset, width, height, startX, startY);
+  return GetSquare(Kernel2D<&WasmNoise::SinglePerlinNoOffset>(), width, height, startX, startY);
 }
 
 // 3D Single
@@ -167,17 +192,17 @@ WN_INLINE WN_DECIMAL WasmNoise::GetPerlin(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
 {
-  return GetStrip<>(&WasmNoise::SinglePerlinNoOffset, length, direction, startX, startY, startZ);
+  return GetStrip(Kernel3D<&WasmNoise::SinglePerlinNoOffset>(), length, direction, startX, startY, startZ);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
 {
-  return GetSquare<>(&WasmNoise::SinglePerlinNoOffset, width, height, plane, startX, startY, startZ);
+  return GetSquare(Kernel3D<&WasmNoise::SinglePerlinNoOffset>(), width, height, plane, startX, startY, startZ);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
 {
-  return GetCube<>(&WasmNoise::SinglePerlinNoOffset, width, height, depth, startX, startY, startZ);
+  return GetCube(Kernel3D<&WasmNoise::SinglePerlinNoOffset>(), width, height, depth, startX, startY, startZ);
 }
 #endif // WN_INCLUDE_PERLIN
 
@@ -200,9 +225,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalStrip(WN_DECIMAL startX, WN_DEC
 {  
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetStrip<>(&WasmNoise::SinglePerlinFractalFBM, length, direction, startX, startY);
-  case FractalType::Billow:       return GetStrip<>(&WasmNoise::SinglePerlinFractalBillow, length, direction, startX, startY);
-  case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SinglePerlinFractalRidgedMulti, length, direction, startX, startY);
+  case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SinglePerlinFractalFBM>(), length, direction, startX, startY);
+  case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SinglePerlinFractalBillow>(), length, direction, startX, startY);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SinglePerlinFractalRidgedMulti>(), length, direction, startX, startY);
   default:
       ABORT();
       return nullptr;
@@ -213,9 +238,22 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalSquare(WN_DECIMAL startX, WN_DE
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetSquare<>(&WasmNoise::SinglePerlinFractalFBM, width, height, startX, startY);
-  case FractalType::Billow:       return GetSquare<>(&WasmNoise::SinglePerlinFractalBillow, width, height, startX, startY);
-  case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SinglePerlinFractalRidgedMulti, width, height, startX, startY);
+  case FractalType::FBM:          return GetSquare(Kernel2D<&WasmNoise::SinglePerlinFractalFBM>(), width, height, startX, startY);
+  case FractalType::Billow:       return GetSquare(Kernel2D<&WasmNoise::SinglePerlinFractalBillow>(), width, height, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel2D<&WasmNoise::SinglePerlinFractalRidgedMulti>(), width, height, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalSquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SinglePerlinFractalFBMOctaves>(), width, height, levels, startX, startY);
+  case FractalType::Billow:       return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SinglePerlinFractalBillowOctaves>(), width, height, levels, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SinglePerlinFractalRidgedMultiOctaves>(), width, height, levels, startX, startY);
   default:
     ABORT();
     return nullptr;
@@ -240,9 +278,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalStrip(WN_DECIMAL startX, WN_DEC
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetStrip<>(&WasmNoise::SinglePerlinFractalFBM, length, direction, startX, startY, startZ);
-  case FractalType::Billow:       return GetStrip<>(&WasmNoise::SinglePerlinFractalBillow, length, direction, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SinglePerlinFractalRidgedMulti, length, direction, startX, startY, startZ);
+  case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SinglePerlinFractalFBM>(), length, direction, startX, startY, startZ);
+  case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SinglePerlinFractalBillow>(), length, direction, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SinglePerlinFractalRidgedMulti>(), length, direction, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
@@ -253,9 +291,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalSquare(WN_DECIMAL startX, WN_DE
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetSquare<>(&WasmNoise::SinglePerlinFractalFBM, width, height, plane, startX, startY, startZ);
-  case FractalType::Billow:       return GetSquare<>(&WasmNoise::SinglePerlinFractalBillow, width, height, plane, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SinglePerlinFractalRidgedMulti, width, height, plane, startX, startY, startZ);
+  case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SinglePerlinFractalFBM>(), width, height, plane, startX, startY, startZ);
+  case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SinglePerlinFractalBillow>(), width, height, plane, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SinglePerlinFractalRidgedMulti>(), width, height, plane, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
@@ -266,12 +304,22 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetPerlinFractalCube(WN_DECIMAL startX, WN_DECI
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetCube<>(&WasmNoise::SinglePerlinFractalFBM, width, height, depth, startX, startY, startZ);
-  case FractalType::Billow:       return GetCube<>(&WasmNoise::SinglePerlinFractalBillow, width, height, depth, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetCube<>(&WasmNoise::SinglePerlinFractalRidgedMulti, width, height, depth, startX, startY, startZ);
+  case FractalType::FBM:          return GetCube(Kernel3D<&WasmNoise::SinglePerlinFractalFBM>(), width, height, depth, startX, startY, startZ);
+  case FractalType::Billow:       return GetCube(Kernel3D<&WasmNoise::SinglePerlinFractalBillow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetCube(Kernel3D<&WasmNoise::SinglePerlinFractalRidgedMulti>(), width, height, depth, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
   }
 }
+
+WN_INLINE uint32 *WasmNoise::GetPerlinFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold)
+{
+  return GetSquareMask(Single2DKernel<&WasmNoise::SinglePerlin>(), width, height, threshold, startX, startY);
+}
+
+WN_INLINE uint32 *WasmNoise::GetPerlinFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold)
+{
+  return GetCubeMask(Single3DKernel<&WasmNoise::SinglePerlin>(), width, height, depth, threshold, startX, startY, startZ);
+}
 #endif // WN_INCLUDE_PERLIN_FRACTAL
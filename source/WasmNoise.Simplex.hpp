@@ -30,8 +30,15 @@ static const uint8 SIMPLEX_4D[] =
 };
 
 // 2D
-WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
 {
+  // Simplex noise is sampled on a skewed lattice, which the chunk origin and period can't be applied 
+  // to. Both are left out, and a chunk origin aborts
+  if(Shifted && HasChunkOrigin())
+  {
+    ABORT();
+  }
+
   WN_DECIMAL t = (x + y) * F2;
   int32 i = FastFloor(x + t);
   int32 j = FastFloor(y + t);
@@ -65,7 +72,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n0 = t * t * GradCoord2D(offset, i, j, x0, y0);
+    n0 = t * t * GradCoord2D<false>(offset, i, j, x0, y0);
   }
 
   t = static_cast<WN_DECIMAL>(0.5) - x1*x1 - y1*y1;
@@ -73,7 +80,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n1 = t * t * GradCoord2D(offset, i + i1, j + j1, x1, y1);
+    n1 = t * t * GradCoord2D<false>(offset, i + i1, j + j1, x1, y1);
   }
 
   t = static_cast<WN_DECIMAL>(0.5) - x2*x2 - y2*y2;
@@ -81,15 +88,25 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n2 = t * t * GradCoord2D(offset, i + 1, j + 1, x2, y2);
+    n2 = t * t * GradCoord2D<false>(offset, i + 1, j + 1, x2, y2);
   }
 
   return 70 * (n0 + n1 + n2);
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SingleSimplex<true>(offset, x, y) : SingleSimplex<false>(offset, x, y);
+}
+
 // 3D
-WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
 {
+  if(Shifted && HasChunkOrigin())
+  {
+    ABORT();
+  }
+
   WN_DECIMAL t = (x + y + z) * F3;
   int32 i = FastFloor(x + t);
   int32 j = FastFloor(y + t);
@@ -155,7 +172,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n0 = t * t * GradCoord3D(offset, i, j, k, x0, y0, z0);
+    n0 = t * t * GradCoord3D<false>(offset, i, j, k, x0, y0, z0);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x1*x1 - y1*y1 - z1*z1;
@@ -163,7 +180,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n1 = t * t * GradCoord3D(offset, i + i1, j + j1, k + k1, x1, y1, z1);
+    n1 = t * t * GradCoord3D<false>(offset, i + i1, j + j1, k + k1, x1, y1, z1);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x2*x2 - y2*y2 - z2*z2;
@@ -171,7 +188,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n2 = t * t * GradCoord3D(offset, i + i2, j + j2, k + k2, x2, y2, z2);
+    n2 = t * t * GradCoord3D<false>(offset, i + i2, j + j2, k + k2, x2, y2, z2);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x3*x3 - y3*y3 - z3*z3;
@@ -179,15 +196,25 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n3 = t * t * GradCoord3D(offset, i + 1, j + 1, k + 1, x3, y3, z3);
+    n3 = t * t * GradCoord3D<false>(offset, i + 1, j + 1, k + 1, x3, y3, z3);
   }
 
   return 32 * (n0 + n1 + n2 + n3);
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SingleSimplex<true>(offset, x, y, z) : SingleSimplex<false>(offset, x, y, z);
+}
+
 // 4D
-WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
 {
+  if(Shifted && HasChunkOrigin())
+  {
+    ABORT();
+  }
+
   WN_DECIMAL n0, n1, n2, n3, n4;
   WN_DECIMAL t = (x + y + z + w) * F4;
   int i = FastFloor(x + t);
@@ -247,7 +274,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n0 = t * t * GradCoord4D(offset, i, j, k, l, x0, y0, z0, w0);
+    n0 = t * t * GradCoord4D<false>(offset, i, j, k, l, x0, y0, z0, w0);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x1*x1 - y1*y1 - z1*z1 - w1*w1;
@@ -255,7 +282,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n1 = t * t * GradCoord4D(offset, i + i1, j + j1, k + k1, l + l1, x1, y1, z1, w1);
+    n1 = t * t * GradCoord4D<false>(offset, i + i1, j + j1, k + k1, l + l1, x1, y1, z1, w1);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x2*x2 - y2*y2 - z2*z2 - w2*w2;
@@ -263,7 +290,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n2 = t * t * GradCoord4D(offset, i + i2, j + j2, k + k2, l + l2, x2, y2, z2, w2);
+    n2 = t * t * GradCoord4D<false>(offset, i + i2, j + j2, k + k2, l + l2, x2, y2, z2, w2);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x3*x3 - y3*y3 - z3*z3 - w3*w3;
@@ -271,7 +298,7 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n3 = t * t * GradCoord4D(offset, i + i3, j + j3, k + k3, l + l3, x3, y3, z3, w3);
+    n3 = t * t * GradCoord4D<false>(offset, i + i3, j + j3, k + k3, l + l3, x3, y3, z3, w3);
   }
 
   t = static_cast<WN_DECIMAL>(0.6) - x4*x4 - y4*y4 - z4*z4 - w4*w4;
@@ -279,12 +306,17 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DEC
   else
   {
     t *= t;
-    n4 = t * t * GradCoord4D(offset, i + 1, j + 1, k + 1, l + 1, x4, y4, z4, w4);
+    n4 = t * t * GradCoord4D<false>(offset, i + 1, j + 1, k + 1, l + 1, x4, y4, z4, w4);
   }
 
   return 27 * (n0 + n1 + n2 + n3 + n4);
 }
 
+WN_INLINE WN_DECIMAL WasmNoise::SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
+{
+  return latticeShifted ? SingleSimplex<true>(offset, x, y, z, w) : SingleSimplex<false>(offset, x, y, z, w);
+}
+
 // Functionally aliases which fill in the offset parameter, allowing them to share
 // the same parameter order as the fractal functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexNoOffset(WN_DECIMAL x, WN_DECIMAL y)
@@ -306,49 +338,64 @@ WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexNoOffset(WN_DECIMAL x, WN_DECIMAL y
 // 2D Simplex Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalFBM(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalFBM<Single2DFPtr>(&WasmNoise::SingleSimplex, x, y);
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SingleSimplex>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalBillow(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalBillow<Single2DFPtr>(&WasmNoise::SingleSimplex, x, y);
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SingleSimplex>(), x, y);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y)
 {
-  return SingleFractalRidgedMulti<Single2DFPtr>(&WasmNoise::SingleSimplex, x, y);
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SingleSimplex>(), x, y);
+}
+
+WN_INLINE void WasmNoise::SingleSimplexFractalFBMOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalFBMOctaves(Single2DKernel<&WasmNoise::SingleSimplex>(), octaveSums, x, y);
+}
+
+WN_INLINE void WasmNoise::SingleSimplexFractalBillowOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalBillowOctaves(Single2DKernel<&WasmNoise::SingleSimplex>(), octaveSums, x, y);
+}
+
+WN_INLINE void WasmNoise::SingleSimplexFractalRidgedMultiOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y)
+{
+  SingleFractalRidgedMultiOctaves(Single2DKernel<&WasmNoise::SingleSimplex>(), octaveSums, x, y);
 }
 
 // 3D Simplex Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalFBM<Single3DFPtr>(&WasmNoise::SingleSimplex, x, y, z);
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SingleSimplex>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalBillow<Single3DFPtr>(&WasmNoise::SingleSimplex, x, y, z);
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SingleSimplex>(), x, y, z);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
 {
-  return SingleFractalRidgedMulti<Single3DFPtr>(&WasmNoise::SingleSimplex, x, y, z);
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SingleSimplex>(), x, y, z);
 }
 
 // 4D Simplex Fractal Functions
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
 {
-  return SingleFractalFBM<Single4DFPtr>(&WasmNoise::SingleSimplex, x, y, z, w);
+  return SingleFractalFBM(Single4DKernel<&WasmNoise::SingleSimplex>(), x, y, z, w);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
 {
-  return SingleFractalBillow<Single4DFPtr>(&WasmNoise::SingleSimplex, x, y, z, w);
+  return SingleFractalBillow(Single4DKernel<&WasmNoise::SingleSimplex>(), x, y, z, w);
 }
 
 WN_INLINE WN_DECIMAL WasmNoise::SingleSimplexFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
 {
-  return SingleFractalRidgedMulti<Single4DFPtr>(&WasmNoise::SingleSimplex, x, y, z, w);
+  return SingleFractalRidgedMulti(Single4DKernel<&WasmNoise::SingleSimplex>(), x, y, z, w);
 }
 #endif // WN_INCLUDE_SIMPLEX_FRACTAL
 
@@ -365,12 +412,12 @@ WN_INLINE WN_DECIMAL WasmNoise::GetSimplex(WN_DECIMAL x, WN_DECIMAL y) const
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
 {
-  return GetStrip<>(&WasmNoise::SinglePerlinNoOffset, length, direction, startX, startY);
+  return GetStrip(Kernel2D<&WasmNoise::SingleSimplexNoOffset>(), length, direction, startX, startY);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
 {
-  return GetSquare<>(&WasmNoise::SingleSimplexNoOffset, width, height, startX, startY);
+  return GetSquare(Kernel2D<&WasmNoise::SingleSimplexNoOffset>(), width, height, startX, startY);
 }
 
 // 3D Single
@@ -381,17 +428,17 @@ WN_INLINE WN_DECIMAL WasmNoise::GetSimplex(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMA
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
 {
-  return GetStrip<>(&WasmNoise::SingleSimplexNoOffset, length, direction, startX, startY, startZ);
+  return GetStrip(Kernel3D<&WasmNoise::SingleSimplexNoOffset>(), length, direction, startX, startY, startZ);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
 {
-  return GetSquare<>(&WasmNoise::SingleSimplexNoOffset, width, height, plane, startX, startY, startZ);
+  return GetSquare(Kernel3D<&WasmNoise::SingleSimplexNoOffset>(), width, height, plane, startX, startY, startZ);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
 {
-  return GetCube<>(&WasmNoise::SingleSimplexNoOffset, width, height, depth, startX, startY, startZ);
+  return GetCube(Kernel3D<&WasmNoise::SingleSimplexNoOffset>(), width, height, depth, startX, startY, startZ);
 }
 
 // 4D Single
@@ -402,17 +449,17 @@ WN_INLINE WN_DECIMAL WasmNoise::GetSimplex(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMA
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction)
 {
-  return GetStrip<>(&WasmNoise::SingleSimplexNoOffset, length, direction, startX, startY, startZ, startW);
+  return GetStrip(Kernel4D<&WasmNoise::SingleSimplexNoOffset>(), length, direction, startX, startY, startZ, startW);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane)
 {
-  return GetSquare<>(&WasmNoise::SingleSimplexNoOffset, width, height, plane, startX, startY, startZ, startW);
+  return GetSquare(Kernel4D<&WasmNoise::SingleSimplexNoOffset>(), width, height, plane, startX, startY, startZ, startW);
 }
 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth)
 {
-  return GetCube<>(&WasmNoise::SingleSimplexNoOffset, width, height, depth, startX, startY, startZ, startW);
+  return GetCube(Kernel4D<&WasmNoise::SingleSimplexNoOffset>(), width, height, depth, startX, startY, startZ, startW);
 }
 #endif // WN_INCLUDE_SIMPLEX
 
@@ -435,9 +482,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalStrip(WN_DECIMAL startX, WN_DE
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleSimplexFractalFBM, length, direction, startX, startY);
-  case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleSimplexFractalBillow, length, direction, startX, startY);
-  case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleSimplexFractalRidgedMulti, length, direction, startX, startY);
+  case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SingleSimplexFractalFBM>(), length, direction, startX, startY);
+  case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SingleSimplexFractalBillow>(), length, direction, startX, startY);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), length, direction, startX, startY);
   default:
     ABORT();
     return nullptr;
@@ -448,9 +495,22 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalSquare(WN_DECIMAL startX, WN_D
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleSimplexFractalFBM, width, height, startX, startY);
-  case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleSimplexFractalBillow, width, height, startX, startY);
-  case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleSimplexFractalRidgedMulti, width, height, startX, startY);
+  case FractalType::FBM:          return GetSquare(Kernel2D<&WasmNoise::SingleSimplexFractalFBM>(), width, height, startX, startY);
+  case FractalType::Billow:       return GetSquare(Kernel2D<&WasmNoise::SingleSimplexFractalBillow>(), width, height, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel2D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), width, height, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalSquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SingleSimplexFractalFBMOctaves>(), width, height, levels, startX, startY);
+  case FractalType::Billow:       return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SingleSimplexFractalBillowOctaves>(), width, height, levels, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquarePyramid(OctavesKernel2D<&WasmNoise::SingleSimplexFractalRidgedMultiOctaves>(), width, height, levels, startX, startY);
   default:
     ABORT();
     return nullptr;
@@ -475,9 +535,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalStrip(WN_DECIMAL startX, WN_DE
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleSimplexFractalFBM, length, direction, startX, startY, startZ);
-  case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleSimplexFractalBillow, length, direction, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleSimplexFractalRidgedMulti, length, direction, startX, startY, startZ);
+  case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SingleSimplexFractalFBM>(), length, direction, startX, startY, startZ);
+  case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SingleSimplexFractalBillow>(), length, direction, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), length, direction, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
@@ -488,9 +548,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalSquare(WN_DECIMAL startX, WN_D
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleSimplexFractalFBM, width, height, plane, startX, startY, startZ);
-  case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleSimplexFractalBillow, width, height, plane, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleSimplexFractalRidgedMulti, width, height, plane, startX, startY, startZ);
+  case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SingleSimplexFractalFBM>(), width, height, plane, startX, startY, startZ);
+  case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SingleSimplexFractalBillow>(), width, height, plane, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), width, height, plane, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
@@ -501,15 +561,25 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalCube(WN_DECIMAL startX, WN_DEC
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetCube<>(&WasmNoise::SingleSimplexFractalFBM, width, height, depth, startX, startY, startZ);
-  case FractalType::Billow:       return GetCube<>(&WasmNoise::SingleSimplexFractalBillow, width, height, depth, startX, startY, startZ);
-  case FractalType::RidgedMulti:  return GetCube<>(&WasmNoise::SingleSimplexFractalRidgedMulti, width, height, depth, startX, startY, startZ);
+  case FractalType::FBM:          return GetCube(Kernel3D<&WasmNoise::SingleSimplexFractalFBM>(), width, height, depth, startX, startY, startZ);
+  case FractalType::Billow:       return GetCube(Kernel3D<&WasmNoise::SingleSimplexFractalBillow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetCube(Kernel3D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), width, height, depth, startX, startY, startZ);
   default:
     ABORT();
     return nullptr;
   }
 }
 
+WN_INLINE uint32 *WasmNoise::GetSimplexFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold)
+{
+  return GetSquareMask(Single2DKernel<&WasmNoise::SingleSimplex>(), width, height, threshold, startX, startY);
+}
+
+WN_INLINE uint32 *WasmNoise::GetSimplexFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold)
+{
+  return GetCubeMask(Single3DKernel<&WasmNoise::SingleSimplex>(), width, height, depth, threshold, startX, startY, startZ);
+}
+
 // 4D Fractal
 WN_INLINE WN_DECIMAL WasmNoise::GetSimplexFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
 {
@@ -528,9 +598,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalStrip(WN_DECIMAL startX, WN_DE
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetStrip<>(&WasmNoise::SingleSimplexFractalFBM, length, direction, startX, startY, startZ, startW);
-  case FractalType::Billow:       return GetStrip<>(&WasmNoise::SingleSimplexFractalBillow, length, direction, startX, startY, startZ, startW);
-  case FractalType::RidgedMulti:  return GetStrip<>(&WasmNoise::SingleSimplexFractalRidgedMulti, length, direction, startX, startY, startZ, startW);
+  case FractalType::FBM:          return GetStrip(Kernel4D<&WasmNoise::SingleSimplexFractalFBM>(), length, direction, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetStrip(Kernel4D<&WasmNoise::SingleSimplexFractalBillow>(), length, direction, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel4D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), length, direction, startX, startY, startZ, startW);
   default:
     ABORT();
     return nullptr;
@@ -541,9 +611,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalSquare(WN_DECIMAL startX, WN_D
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetSquare<>(&WasmNoise::SingleSimplexFractalFBM, width, height, plane, startX, startY, startZ, startW);
-  case FractalType::Billow:       return GetSquare<>(&WasmNoise::SingleSimplexFractalBillow, width, height, plane, startX, startY, startZ, startW);
-  case FractalType::RidgedMulti:  return GetSquare<>(&WasmNoise::SingleSimplexFractalRidgedMulti, width, height, plane, startX, startY, startZ, startW);
+  case FractalType::FBM:          return GetSquare(Kernel4D<&WasmNoise::SingleSimplexFractalFBM>(), width, height, plane, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetSquare(Kernel4D<&WasmNoise::SingleSimplexFractalBillow>(), width, height, plane, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel4D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), width, height, plane, startX, startY, startZ, startW);
   default:
     ABORT();
     return nullptr;
@@ -554,9 +624,9 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSimplexFractalCube(WN_DECIMAL startX, WN_DEC
 {
   switch(fractalType)
   {
-  case FractalType::FBM:          return GetCube<>(&WasmNoise::SingleSimplexFractalFBM, width, height, depth, startX, startY, startZ, startW);
-  case FractalType::Billow:       return GetCube<>(&WasmNoise::SingleSimplexFractalBillow, width, height, depth, startX, startY, startZ, startW);
-  case FractalType::RidgedMulti:  return GetCube<>(&WasmNoise::SingleSimplexFractalRidgedMulti, width, height, depth, startX, startY, startZ, startW);
+  case FractalType::FBM:          return GetCube(Kernel4D<&WasmNoise::SingleSimplexFractalFBM>(), width, height, depth, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetCube(Kernel4D<&WasmNoise::SingleSimplexFractalBillow>(), width, height, depth, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetCube(Kernel4D<&WasmNoise::SingleSimplexFractalRidgedMulti>(), width, height, depth, startX, startY, startZ, startW);
   default:
     ABORT();
     return nullptr;
@@ -0,0 +1,722 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+#include "WasmNoise.Fractal.hpp"
+#endif
+
+// Single Noise Function Section *******************************
+// These functions are required for both regular and fractal value noise
+
+WN_INLINE WN_DECIMAL WasmNoise::Interpolate(WN_DECIMAL t) const
+{
+  switch(interp)
+  {
+  case Interp::Hermite: return InterpHermiteFunc(t);
+  case Interp::Quintic: return InterpQuinticFunc(t);
+  default:              return t;
+  }
+}
+
+// 2D Value
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  int32 x0 = FastFloor(x);
+  int32 y0 = FastFloor(y);
+  int32 x1 = x0 + 1;
+  int32 y1 = y0 + 1;
+
+  WN_DECIMAL xs = Interpolate(x - static_cast<WN_DECIMAL>(x0));
+  WN_DECIMAL ys = Interpolate(y - static_cast<WN_DECIMAL>(y0));
+
+  WN_DECIMAL xf0 = Lerp(ValCoord2DFast<Shifted>(offset, x0, y0), ValCoord2DFast<Shifted>(offset, x1, y0), xs);
+  WN_DECIMAL xf1 = Lerp(ValCoord2DFast<Shifted>(offset, x0, y1), ValCoord2DFast<Shifted>(offset, x1, y1), xs);
+
+  return Lerp(xf0, xf1, ys);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return latticeShifted ? SingleValue<true>(offset, x, y) : SingleValue<false>(offset, x, y);
+}
+
+// 3D Value
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  int32 x0 = FastFloor(x);
+  int32 y0 = FastFloor(y);
+  int32 z0 = FastFloor(z);
+  int32 x1 = x0 + 1;
+  int32 y1 = y0 + 1;
+  int32 z1 = z0 + 1;
+
+  WN_DECIMAL xs = Interpolate(x - static_cast<WN_DECIMAL>(x0));
+  WN_DECIMAL ys = Interpolate(y - static_cast<WN_DECIMAL>(y0));
+  WN_DECIMAL zs = Interpolate(z - static_cast<WN_DECIMAL>(z0));
+
+  WN_DECIMAL xf00 = Lerp(ValCoord3DFast<Shifted>(offset, x0, y0, z0), ValCoord3DFast<Shifted>(offset, x1, y0, z0), xs);
+  WN_DECIMAL xf10 = Lerp(ValCoord3DFast<Shifted>(offset, x0, y1, z0), ValCoord3DFast<Shifted>(offset, x1, y1, z0), xs);
+  WN_DECIMAL xf01 = Lerp(ValCoord3DFast<Shifted>(offset, x0, y0, z1), ValCoord3DFast<Shifted>(offset, x1, y0, z1), xs);
+  WN_DECIMAL xf11 = Lerp(ValCoord3DFast<Shifted>(offset, x0, y1, z1), ValCoord3DFast<Shifted>(offset, x1, y1, z1), xs);
+
+  WN_DECIMAL yf0 = Lerp(xf00, xf10, ys);
+  WN_DECIMAL yf1 = Lerp(xf01, xf11, ys);
+
+  return Lerp(yf0, yf1, zs);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return latticeShifted ? SingleValue<true>(offset, x, y, z) : SingleValue<false>(offset, x, y, z);
+}
+
+// 4D Value
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
+{
+  int32 x0 = FastFloor(x);
+  int32 y0 = FastFloor(y);
+  int32 z0 = FastFloor(z);
+  int32 w0 = FastFloor(w);
+  int32 x1 = x0 + 1;
+  int32 y1 = y0 + 1;
+  int32 z1 = z0 + 1;
+  int32 w1 = w0 + 1;
+
+  WN_DECIMAL xs = Interpolate(x - static_cast<WN_DECIMAL>(x0));
+  WN_DECIMAL ys = Interpolate(y - static_cast<WN_DECIMAL>(y0));
+  WN_DECIMAL zs = Interpolate(z - static_cast<WN_DECIMAL>(z0));
+  WN_DECIMAL ws = Interpolate(w - static_cast<WN_DECIMAL>(w0));
+
+  WN_DECIMAL xf000 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y0, z0, w0), ValCoord4DFast<Shifted>(offset, x1, y0, z0, w0), xs);
+  WN_DECIMAL xf100 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y1, z0, w0), ValCoord4DFast<Shifted>(offset, x1, y1, z0, w0), xs);
+  WN_DECIMAL xf010 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y0, z1, w0), ValCoord4DFast<Shifted>(offset, x1, y0, z1, w0), xs);
+  WN_DECIMAL xf110 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y1, z1, w0), ValCoord4DFast<Shifted>(offset, x1, y1, z1, w0), xs);
+  WN_DECIMAL xf001 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y0, z0, w1), ValCoord4DFast<Shifted>(offset, x1, y0, z0, w1), xs);
+  WN_DECIMAL xf101 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y1, z0, w1), ValCoord4DFast<Shifted>(offset, x1, y1, z0, w1), xs);
+  WN_DECIMAL xf011 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y0, z1, w1), ValCoord4DFast<Shifted>(offset, x1, y0, z1, w1), xs);
+  WN_DECIMAL xf111 = Lerp(ValCoord4DFast<Shifted>(offset, x0, y1, z1, w1), ValCoord4DFast<Shifted>(offset, x1, y1, z1, w1), xs);
+
+  WN_DECIMAL yf00 = Lerp(xf000, xf100, ys);
+  WN_DECIMAL yf10 = Lerp(xf010, xf110, ys);
+  WN_DECIMAL yf01 = Lerp(xf001, xf101, ys);
+  WN_DECIMAL yf11 = Lerp(xf011, xf111, ys);
+
+  WN_DECIMAL zf0 = Lerp(yf00, yf10, zs);
+  WN_DECIMAL zf1 = Lerp(yf01, yf11, zs);
+
+  return Lerp(zf0, zf1, ws);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
+{
+  return latticeShifted ? SingleValue<true>(offset, x, y, z, w) : SingleValue<false>(offset, x, y, z, w);
+}
+
+// Row kernels
+// Every sample of a row shares its Y (and Z) lattice coordinates, so the lattice rows for them 
+// are looked up once per row. Each lattice column is blended along Y (and Z) once and reused by 
+// all the samples which fall between it and the next column, stepping to the next lattice cell 
+// only needs the one new column.
+
+// 2D Value Row
+template<bool Shifted> WN_INLINE void WasmNoise::SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const
+{
+  int32 y0 = FastFloor(y);
+  WN_DECIMAL ys = Interpolate(y - static_cast<WN_DECIMAL>(y0));
+
+  LatticeRow row0 = RowLookup<Shifted>(offset, y0);
+  LatticeRow row1 = RowLookup<Shifted>(offset, y0 + 1);
+  auto column = [&](int32 cx) 
+  { 
+    return Lerp(ValFromIndex(RowIndex_256<Shifted>(row0, cx)), ValFromIndex(RowIndex_256<Shifted>(row1, cx)), ys); 
+  };
+
+  int32 x0 = FastFloor(x);
+  WN_DECIMAL c0 = column(x0);
+  WN_DECIMAL c1 = column(x0 + 1);
+
+  for(uint32 i = 0; i < length; i++)
+  {
+    WN_DECIMAL xi = x + i * xStep;
+    int32 xf = FastFloor(xi);
+    if(xf != x0)
+    {
+      // Stepping into the next cell keeps the right hand column
+      c0 = (xf == x0 + 1) ? c1 : column(xf);
+      c1 = column(xf + 1);
+      x0 = xf;
+    }
+    values[i] = Lerp(c0, c1, Interpolate(xi - static_cast<WN_DECIMAL>(x0)));
+  }
+}
+
+WN_INLINE void WasmNoise::SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const
+{
+  latticeShifted ? SingleValueRow<true>(offset, values, length, x, xStep, y) : SingleValueRow<false>(offset, values, length, x, xStep, y);
+}
+
+// 3D Value Row
+template<bool Shifted> WN_INLINE void WasmNoise::SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  int32 y0 = FastFloor(y);
+  int32 z0 = FastFloor(z);
+  WN_DECIMAL ys = Interpolate(y - static_cast<WN_DECIMAL>(y0));
+  WN_DECIMAL zs = Interpolate(z - static_cast<WN_DECIMAL>(z0));
+
+  LatticeRow row00 = RowLookup<Shifted>(offset, y0, z0);
+  LatticeRow row10 = RowLookup<Shifted>(offset, y0 + 1, z0);
+  LatticeRow row01 = RowLookup<Shifted>(offset, y0, z0 + 1);
+  LatticeRow row11 = RowLookup<Shifted>(offset, y0 + 1, z0 + 1);
+  auto column = [&](int32 cx)
+  {
+    WN_DECIMAL yf0 = Lerp(ValFromIndex(RowIndex_256<Shifted>(row00, cx)), ValFromIndex(RowIndex_256<Shifted>(row10, cx)), ys);
+    WN_DECIMAL yf1 = Lerp(ValFromIndex(RowIndex_256<Shifted>(row01, cx)), ValFromIndex(RowIndex_256<Shifted>(row11, cx)), ys);
+    return Lerp(yf0, yf1, zs);
+  };
+
+  int32 x0 = FastFloor(x);
+  WN_DECIMAL c0 = column(x0);
+  WN_DECIMAL c1 = column(x0 + 1);
+
+  for(uint32 i = 0; i < length; i++)
+  {
+    WN_DECIMAL xi = x + i * xStep;
+    int32 xf = FastFloor(xi);
+    if(xf != x0)
+    {
+      c0 = (xf == x0 + 1) ? c1 : column(xf);
+      c1 = column(xf + 1);
+      x0 = xf;
+    }
+    values[i] = Lerp(c0, c1, Interpolate(xi - static_cast<WN_DECIMAL>(x0)));
+  }
+}
+
+WN_INLINE void WasmNoise::SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  latticeShifted ? SingleValueRow<true>(offset, values, length, x, xStep, y, z) : SingleValueRow<false>(offset, values, length, x, xStep, y, z);
+}
+
+// Functionally aliases which fill in the offset parameter, allowing them to share
+// the same parameter order as the fractal functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleValue(0, x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleValue(0, x, y, z);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return SingleValue(0, x, y, z, w);
+}
+
+WN_INLINE void WasmNoise::SingleValueRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleValueRow(0, values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleValueRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleValueRow(0, values, length, x, xStep, y, z);
+}
+
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+// 2D Value Fractal Functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalFBM(Single2DKernel<&WasmNoise::SingleValue>(), x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalBillow(Single2DKernel<&WasmNoise::SingleValue>(), x, y);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleFractalRidgedMulti(Single2DKernel<&WasmNoise::SingleValue>(), x, y);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalFBMRow(SingleRow2DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalBillowRow(SingleRow2DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y)
+{
+  SingleFractalRidgedMultiRow(SingleRow2DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y);
+}
+
+// 3D Value Fractal Functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalFBM(Single3DKernel<&WasmNoise::SingleValue>(), x, y, z);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalBillow(Single3DKernel<&WasmNoise::SingleValue>(), x, y, z);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleFractalRidgedMulti(Single3DKernel<&WasmNoise::SingleValue>(), x, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalFBMRow(SingleRow3DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalBillowRow(SingleRow3DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y, z);
+}
+
+WN_INLINE void WasmNoise::SingleValueFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z)
+{
+  SingleFractalRidgedMultiRow(SingleRow3DKernel<&WasmNoise::SingleValueRow>(), values, length, x, xStep, y, z);
+}
+
+// Within a lattice cell value noise is multilinear in the interpolated offsets, and the interpolation 
+// curves only ever rise from 0 to 1, so its extremes over a box in the cell lie on the corners of that 
+// box. Evaluating the noise on the box corners plus every lattice plane crossing the box gives the exact 
+// range. Boxes spanning more than SparseBoundsMaxCells cells on an axis get the full [-1, 1] range
+WN_INLINE void WasmNoise::ValueLatticeBounds(uint8 offset, const WN_DECIMAL *lo, const WN_DECIMAL *hi, WN_DECIMAL &minValue, WN_DECIMAL &maxValue) const
+{
+  WN_DECIMAL planes[3][SparseBoundsMaxCells + 1];
+  uint32 planeCount[3];
+  for(uint32 axis = 0; axis < 3; axis++)
+  {
+    int32 first = FastFloor(lo[axis]);
+    int32 last = FastFloor(hi[axis]);
+    if(last - first >= SparseBoundsMaxCells)
+    {
+      minValue = -1;
+      maxValue = 1;
+      return;
+    }
+
+    uint32 count = 0;
+    planes[axis][count++] = lo[axis];
+    for(int32 i = first + 1; i <= last; i++)
+    {
+      planes[axis][count++] = static_cast<WN_DECIMAL>(i);
+    }
+    planes[axis][count++] = hi[axis];
+    planeCount[axis] = count;
+  }
+
+  minValue = 1;
+  maxValue = -1;
+  for(uint32 z = 0; z < planeCount[2]; z++)
+  {
+    for(uint32 y = 0; y < planeCount[1]; y++)
+    {
+      for(uint32 x = 0; x < planeCount[0]; x++)
+      {
+        WN_DECIMAL value = SingleValue(offset, planes[0][x], planes[1][y], planes[2][z]);
+        minValue = min(minValue, value);
+        maxValue = max(maxValue, value);
+      }
+    }
+  }
+}
+
+// Sums the octave ranges the same way SingleFractalFBM and SingleFractalBillow sum the octaves, 
+// lo and hi are the lattice space box of the first octave and are scaled along with it
+WN_INLINE void WasmNoise::ValueFractalBounds(WN_DECIMAL *lo, WN_DECIMAL *hi, WN_DECIMAL &minValue, WN_DECIMAL &maxValue)
+{
+  OctaveOrigin origin(*this);
+  WN_DECIMAL amp = 1;
+  minValue = 0;
+  maxValue = 0;
+
+  for(uint32 i = 0; i < fractalOctaves; i++)
+  {
+    WN_DECIMAL octaveMin, octaveMax;
+    ValueLatticeBounds(perm[i], lo, hi, octaveMin, octaveMax);
+    if(fractalType == FractalType::Billow)
+    {
+      WN_DECIMAL absMax = max(FastAbs(octaveMin), FastAbs(octaveMax));
+      WN_DECIMAL absMin = (octaveMin <= 0 && octaveMax >= 0) ? 0 : min(FastAbs(octaveMin), FastAbs(octaveMax));
+      octaveMin = absMin * 2 - 1;
+      octaveMax = absMax * 2 - 1;
+    }
+    minValue += min(octaveMin * amp, octaveMax * amp);
+    maxValue += max(octaveMin * amp, octaveMax * amp);
+
+    for(uint32 axis = 0; axis < 3; axis++)
+    {
+      lo[axis] *= fractalLacunarity;
+      hi[axis] *= fractalLacunarity;
+    }
+    origin.Next();
+    amp *= fractalGain;
+  }
+
+  minValue *= fractalBounding;
+  maxValue *= fractalBounding;
+}
+
+// 4D Value Fractal Functions
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return SingleFractalFBM(Single4DKernel<&WasmNoise::SingleValue>(), x, y, z, w);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return SingleFractalBillow(Single4DKernel<&WasmNoise::SingleValue>(), x, y, z, w);
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return SingleFractalRidgedMulti(Single4DKernel<&WasmNoise::SingleValue>(), x, y, z, w);
+}
+#endif // WN_INCLUDE_VALUE_FRACTAL
+
+// End Single Noise Function Section *******************************
+
+// Public Value Noise Functions
+
+#ifdef WN_INCLUDE_VALUE
+// 2D Single
+WN_INLINE WN_DECIMAL WasmNoise::GetValue(WN_DECIMAL x, WN_DECIMAL y) const
+{
+  return SingleValue(0, x * frequency, y * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel2D<&WasmNoise::SingleValueNoOffset>(), length, direction, startX, startY);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  return GetSquareRows(RowKernel2D<&WasmNoise::SingleValueRowNoOffset>(), width, height, startX, startY);
+}
+
+// 3D Single
+WN_INLINE WN_DECIMAL WasmNoise::GetValue(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const
+{
+  return SingleValue(0, x * frequency, y * frequency, z * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel3D<&WasmNoise::SingleValueNoOffset>(), length, direction, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  if(plane == SquarePlane::XYPlane)
+  {
+    return GetSquareRows(RowKernel3D<&WasmNoise::SingleValueRowNoOffset>(), width, height, startX, startY, startZ);
+  }
+  return GetSquare(Kernel3D<&WasmNoise::SingleValueNoOffset>(), width, height, plane, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
+{
+  return GetCubeRows(RowKernel3D<&WasmNoise::SingleValueRowNoOffset>(), width, height, depth, startX, startY, startZ);
+}
+
+// 4D Single
+WN_INLINE WN_DECIMAL WasmNoise::GetValue(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const
+{
+  return SingleValue(0, x * frequency, y * frequency, z * frequency, w * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel4D<&WasmNoise::SingleValueNoOffset>(), length, direction, startX, startY, startZ, startW);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane)
+{
+  return GetSquare(Kernel4D<&WasmNoise::SingleValueNoOffset>(), width, height, plane, startX, startY, startZ, startW);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth)
+{
+  return GetCube(Kernel4D<&WasmNoise::SingleValueNoOffset>(), width, height, depth, startX, startY, startZ, startW);
+}
+#endif // WN_INCLUDE_VALUE
+
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+// 2D Fractal
+WN_INLINE WN_DECIMAL WasmNoise::GetValueFractal(WN_DECIMAL x, WN_DECIMAL y)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleValueFractalFBM(x * frequency, y * frequency);
+  case FractalType::Billow:       return SingleValueFractalBillow(x * frequency, y * frequency);
+  case FractalType::RidgedMulti:  return SingleValueFractalRidgedMulti(x * frequency, y * frequency);
+  default:
+    ABORT();
+    return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetStrip(Kernel2D<&WasmNoise::SingleValueFractalFBM>(), length, direction, startX, startY);
+  case FractalType::Billow:       return GetStrip(Kernel2D<&WasmNoise::SingleValueFractalBillow>(), length, direction, startX, startY);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel2D<&WasmNoise::SingleValueFractalRidgedMulti>(), length, direction, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquareRows(RowKernel2D<&WasmNoise::SingleValueFractalFBMRow>(), width, height, startX, startY);
+  case FractalType::Billow:       return GetSquareRows(RowKernel2D<&WasmNoise::SingleValueFractalBillowRow>(), width, height, startX, startY);
+  case FractalType::RidgedMulti:  return GetSquareRows(RowKernel2D<&WasmNoise::SingleValueFractalRidgedMultiRow>(), width, height, startX, startY);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+// 3D Fractal
+WN_INLINE WN_DECIMAL WasmNoise::GetValueFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleValueFractalFBM(x * frequency, y * frequency, z * frequency);
+  case FractalType::Billow:       return SingleValueFractalBillow(x * frequency, y * frequency, z * frequency);
+  case FractalType::RidgedMulti:  return SingleValueFractalRidgedMulti(x * frequency, y * frequency, z * frequency);
+  default:
+    ABORT();
+    return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetStrip(Kernel3D<&WasmNoise::SingleValueFractalFBM>(), length, direction, startX, startY, startZ);
+  case FractalType::Billow:       return GetStrip(Kernel3D<&WasmNoise::SingleValueFractalBillow>(), length, direction, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel3D<&WasmNoise::SingleValueFractalRidgedMulti>(), length, direction, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  if(plane == SquarePlane::XYPlane)
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return GetSquareRows(RowKernel3D<&WasmNoise::SingleValueFractalFBMRow>(), width, height, startX, startY, startZ);
+    case FractalType::Billow:       return GetSquareRows(RowKernel3D<&WasmNoise::SingleValueFractalBillowRow>(), width, height, startX, startY, startZ);
+    case FractalType::RidgedMulti:  return GetSquareRows(RowKernel3D<&WasmNoise::SingleValueFractalRidgedMultiRow>(), width, height, startX, startY, startZ);
+    default:
+      ABORT();
+      return nullptr;
+    }
+  }
+
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquare(Kernel3D<&WasmNoise::SingleValueFractalFBM>(), width, height, plane, startX, startY, startZ);
+  case FractalType::Billow:       return GetSquare(Kernel3D<&WasmNoise::SingleValueFractalBillow>(), width, height, plane, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel3D<&WasmNoise::SingleValueFractalRidgedMulti>(), width, height, plane, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetCubeRows(RowKernel3D<&WasmNoise::SingleValueFractalFBMRow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::Billow:       return GetCubeRows(RowKernel3D<&WasmNoise::SingleValueFractalBillowRow>(), width, height, depth, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetCubeRows(RowKernel3D<&WasmNoise::SingleValueFractalRidgedMultiRow>(), width, height, depth, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE uint32 *WasmNoise::GetValueFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold)
+{
+  return GetSquareMask(Single2DKernel<&WasmNoise::SingleValue>(), width, height, threshold, startX, startY);
+}
+
+WN_INLINE uint32 *WasmNoise::GetValueFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold)
+{
+  return GetCubeMask(Single3DKernel<&WasmNoise::SingleValue>(), width, height, depth, threshold, startX, startY, startZ);
+}
+
+// Sparse cubes bound every brick first and only evaluate the bricks whose range reaches across the 
+// threshold. Ridged multi fractals aren't bounded, all of their bricks are evaluated. Values of a dense 
+// brick are BrickSize^3 row-major samples, the output layout and target don't apply
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueSparseCube(RowFunc func, bool bounded, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  if(width == 0 || height == 0 || depth == 0 || width % BrickSize != 0 || height % BrickSize != 0 || depth % BrickSize != 0)
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  uint32 bricksX = width / BrickSize;
+  uint32 bricksY = height / BrickSize;
+  uint32 bricksZ = depth / BrickSize;
+  sparseBrickMap = sparseHelper.NewArray(bricksX * bricksY * bricksZ);
+  sparseBrickCount = 0;
+
+  const WN_DECIMAL start[3] = { startX, startY, startZ };
+  const WN_DECIMAL step[3] = { sampleStepX, sampleStepY, sampleStepZ };
+  uint32 brick = 0;
+  for(uint32 bz = 0; bz < bricksZ; bz++)
+  {
+    for(uint32 by = 0; by < bricksY; by++)
+    {
+      for(uint32 bx = 0; bx < bricksX; bx++, brick++)
+      {
+        if(bounded)
+        {
+          const uint32 first[3] = { bx * BrickSize, by * BrickSize, bz * BrickSize };
+          WN_DECIMAL lo[3], hi[3];
+          for(uint32 axis = 0; axis < 3; axis++)
+          {
+            WN_DECIMAL a = (start[axis] + first[axis]*step[axis]) * frequency;
+            WN_DECIMAL b = (start[axis] + (first[axis] + BrickSize - 1)*step[axis]) * frequency;
+            lo[axis] = min(a, b);
+            hi[axis] = max(a, b);
+          }
+
+          WN_DECIMAL minValue, maxValue;
+          ValueFractalBounds(lo, hi, minValue, maxValue);
+          if(maxValue < threshold - SparseBoundsEpsilon)
+          {
+            sparseBrickMap[brick] = SparseBrickBelow;
+            continue;
+          }
+          if(minValue > threshold + SparseBoundsEpsilon)
+          {
+            sparseBrickMap[brick] = SparseBrickAbove;
+            continue;
+          }
+        }
+        sparseBrickMap[brick] = SparseBrickDense + sparseBrickCount++;
+      }
+    }
+  }
+
+  WN_DECIMAL *values = returnHelper.NewArray(sparseBrickCount * BrickSize * BrickSize * BrickSize);
+  WN_DECIMAL *out = values;
+  for(brick = 0; brick < bricksX * bricksY * bricksZ; brick++)
+  {
+    if(sparseBrickMap[brick] < SparseBrickDense)
+    {
+      continue;
+    }
+
+    uint32 x0 = (brick % bricksX) * BrickSize;
+    uint32 y0 = ((brick / bricksX) % bricksY) * BrickSize;
+    uint32 z0 = (brick / (bricksX * bricksY)) * BrickSize;
+    for(uint32 z = z0; z < z0 + BrickSize; z++)
+    {
+      for(uint32 y = y0; y < y0 + BrickSize; y++, out += BrickSize)
+      {
+        invoke(func, *this, out, BrickSize, (startX + x0*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency);
+        for(uint32 i = 0; remapLUT != nullptr && i < BrickSize; i++)
+        {
+          out[i] = Remap(out[i]);
+        }
+      }
+    }
+  }
+  return values;
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalSparseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetValueSparseCube(RowKernel3D<&WasmNoise::SingleValueFractalFBMRow>(), true, width, height, depth, threshold, startX, startY, startZ);
+  case FractalType::Billow:       return GetValueSparseCube(RowKernel3D<&WasmNoise::SingleValueFractalBillowRow>(), true, width, height, depth, threshold, startX, startY, startZ);
+  case FractalType::RidgedMulti:  return GetValueSparseCube(RowKernel3D<&WasmNoise::SingleValueFractalRidgedMultiRow>(), false, width, height, depth, threshold, startX, startY, startZ);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+// 4D Fractal
+WN_INLINE WN_DECIMAL WasmNoise::GetValueFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return SingleValueFractalFBM(x * frequency, y * frequency, z * frequency, w * frequency);
+  case FractalType::Billow:       return SingleValueFractalBillow(x * frequency, y * frequency, z * frequency, w * frequency);
+  case FractalType::RidgedMulti:  return SingleValueFractalRidgedMulti(x * frequency, y * frequency, z * frequency, w * frequency);
+  default:
+    ABORT();
+    return 0;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetStrip(Kernel4D<&WasmNoise::SingleValueFractalFBM>(), length, direction, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetStrip(Kernel4D<&WasmNoise::SingleValueFractalBillow>(), length, direction, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetStrip(Kernel4D<&WasmNoise::SingleValueFractalRidgedMulti>(), length, direction, startX, startY, startZ, startW);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetSquare(Kernel4D<&WasmNoise::SingleValueFractalFBM>(), width, height, plane, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetSquare(Kernel4D<&WasmNoise::SingleValueFractalBillow>(), width, height, plane, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetSquare(Kernel4D<&WasmNoise::SingleValueFractalRidgedMulti>(), width, height, plane, startX, startY, startZ, startW);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetValueFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth)
+{
+  switch(fractalType)
+  {
+  case FractalType::FBM:          return GetCube(Kernel4D<&WasmNoise::SingleValueFractalFBM>(), width, height, depth, startX, startY, startZ, startW);
+  case FractalType::Billow:       return GetCube(Kernel4D<&WasmNoise::SingleValueFractalBillow>(), width, height, depth, startX, startY, startZ, startW);
+  case FractalType::RidgedMulti:  return GetCube(Kernel4D<&WasmNoise::SingleValueFractalRidgedMulti>(), width, height, depth, startX, startY, startZ, startW);
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+#endif // WN_INCLUDE_VALUE_FRACTAL
@@ -0,0 +1,105 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+#include "invoke.hpp"
+
+// The viewport keeps its samples in a ring buffer, so the sample at (x, y) relative
+// to the start of the viewport always lives at slot (x % width, y % height). 
+// Panning moves the view and only generates the rows and columns which have
+// just come into view, the rest of the buffer is left untouched.
+
+void WasmNoise::FillViewport(int32 fromX, int32 toX, int32 fromY, int32 toY)
+{
+  int32 width = static_cast<int32>(viewportWidth);
+  int32 height = static_cast<int32>(viewportHeight);
+  int32 slotXStart = WrapIndex(fromX, width);
+  int32 slotY = WrapIndex(fromY, height);
+
+  for(int32 y = fromY; y < toY; y++)
+  {
+    WN_DECIMAL *row = viewportValues + (width * slotY);
+    int32 slotX = slotXStart;
+    for(int32 x = fromX; x < toX; x++)
+    {
+      row[slotX] = Remap(invoke(viewportFunc, *this, (viewportStartX + x) * frequency, (viewportStartY + y) * frequency));
+      if(++slotX == width) slotX = 0;
+    }
+    if(++slotY == height) slotY = 0;
+  }
+}
+
+WN_DECIMAL *WasmNoise::SetViewport(NoiseType noiseType, WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  viewportFunc = GetNoiseFunc<FPtr2D>(noiseType);
+  if(viewportFunc == nullptr || width == 0 || height == 0)
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  viewportValues = viewportHelper.NewArray(width*height);
+  viewportWidth = width;
+  viewportHeight = height;
+  viewportStartX = startX;
+  viewportStartY = startY;
+  viewportX = 0;
+  viewportY = 0;
+
+  FillViewport(0, static_cast<int32>(width), 0, static_cast<int32>(height));
+  return viewportValues;
+}
+
+uint32 WasmNoise::PanViewport(int32 dx, int32 dy)
+{
+  if(viewportValues == nullptr)
+  {
+    ABORT();
+    return 0;
+  }
+
+  int32 width = static_cast<int32>(viewportWidth);
+  int32 height = static_cast<int32>(viewportHeight);
+  viewportX += dx;
+  viewportY += dy;
+
+  // Nothing of the old view survives, regenerate it all
+  if(FastAbs(dx) >= width || FastAbs(dy) >= height)
+  {
+    FillViewport(viewportX, viewportX + width, viewportY, viewportY + height);
+    return GetViewportRingOffset();
+  }
+
+  // Newly exposed columns, over the full height of the view
+  int32 keptFromX = viewportX;
+  int32 keptToX = viewportX + width;
+  if(dx > 0)
+  {
+    FillViewport(keptToX - dx, keptToX, viewportY, viewportY + height);
+    keptToX -= dx;
+  }
+  else if(dx < 0)
+  {
+    FillViewport(keptFromX, keptFromX - dx, viewportY, viewportY + height);
+    keptFromX -= dx;
+  }
+
+  // Newly exposed rows, skipping the corner already filled by the columns
+  if(dy > 0)
+  {
+    FillViewport(keptFromX, keptToX, viewportY + height - dy, viewportY + height);
+  }
+  else if(dy < 0)
+  {
+    FillViewport(keptFromX, keptToX, viewportY, viewportY - dy);
+  }
+
+  return GetViewportRingOffset();
+}
+
+uint32 WasmNoise::GetViewportRingOffset() const
+{
+  int32 width = static_cast<int32>(viewportWidth);
+  int32 height = static_cast<int32>(viewportHeight);
+  if(width == 0 || height == 0) return 0;
+  return static_cast<uint32>(WrapIndex(viewportY, height) * width + WrapIndex(viewportX, width));
+}
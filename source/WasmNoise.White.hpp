@@ -0,0 +1,336 @@
+#pragma once
+#include "WasmNoise.hpp"
+#include "WasmNoise.Common.hpp"
+
+// White noise has no lattice or permutation table, each sample is just a hash of the seed and its 
+// coordinates so samples are completely independent of each other.
+// Float coordinates are hashed by their bit pattern, integer coordinates are hashed directly.
+
+constexpr int32 AXIS_PRIMES[] = { XPrime, YPrime, ZPrime, WPrime };
+
+// Single Noise Function Section *******************************
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleWhite(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return ValCoord2D(seed, FloatCast2Int(x), FloatCast2Int(y));
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleWhite(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return ValCoord3D(seed, FloatCast2Int(x), FloatCast2Int(y), FloatCast2Int(z));
+}
+
+WN_INLINE WN_DECIMAL WasmNoise::SingleWhite(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return ValCoord4D(seed, FloatCast2Int(x), FloatCast2Int(y), FloatCast2Int(z), FloatCast2Int(w));
+}
+
+// Integer grids
+// The hash XORs together one term per axis, so the terms for the fixed axes are combined once up 
+// front and the depth and row terms once per slice and row, leaving one multiply and XOR per sample
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteIntGrid(const int32 *start, uint32 dimensions, uint32 uAxis, uint32 width, uint32 vAxis, uint32 height, uint32 wAxis, uint32 depth)
+{
+  int32 hash = seed;
+  for(uint32 a = 0; a < dimensions; a++)
+  {
+    if(a != uAxis && a != vAxis && a != wAxis)
+    {
+      hash ^= AXIS_PRIMES[a] * start[a];
+    }
+  }
+  // Unused axes (== dimensions) step nothing
+  int32 uPrime = (uAxis < dimensions) ? AXIS_PRIMES[uAxis] : 0;
+  int32 vPrime = (vAxis < dimensions) ? AXIS_PRIMES[vAxis] : 0;
+  int32 wPrime = (wAxis < dimensions) ? AXIS_PRIMES[wAxis] : 0;
+  int32 uStart = (uAxis < dimensions) ? start[uAxis] : 0;
+  int32 vStart = (vAxis < dimensions) ? start[vAxis] : 0;
+  int32 wStart = (wAxis < dimensions) ? start[wAxis] : 0;
+
+  // Strips are always linear, squares and cubes follow the output layout and row stride
+  bool strip = height == 1 && depth == 1;
+  bool linear = strip || (outputLayout == OutputLayout::RowMajor && LayoutRowStride(width) == width);
+  if(!linear && !IsValidLayout(width, height, depth))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  WN_DECIMAL *values = strip ? returnHelper.NewArray(width) : NewOutput(width, height, depth);
+  WN_DECIMAL *out = values;
+  for(uint32 w = 0; w < depth; w++)
+  {
+    int32 wHash = hash ^ (wPrime * (wStart + static_cast<int32>(w)));
+    for(uint32 v = 0; v < height; v++)
+    {
+      int32 vHash = wHash ^ (vPrime * (vStart + static_cast<int32>(v)));
+      if(linear)
+      {
+        for(uint32 u = 0; u < width; u++)
+        {
+          *out++ = Remap(ValFromHash(vHash ^ (uPrime * (uStart + static_cast<int32>(u)))));
+        }
+      }
+      else
+      {
+        uint32 rowOffset = LayoutOffset(1, v, width, height, depth) + LayoutOffset(2, w, width, height, depth);
+        for(uint32 u = 0; u < width; u++)
+        {
+          values[rowOffset + LayoutOffset(0, u, width, height, depth)] = Remap(ValFromHash(vHash ^ (uPrime * (uStart + static_cast<int32>(u)))));
+        }
+      }
+    }
+  }
+  return values;
+}
+
+// Returns the axes spanned by the width and height of a square, false if the plane doesn't exist
+// in the given number of dimensions
+static WN_INLINE bool GetPlaneAxes(WasmNoise::SquarePlane plane, uint32 dimensions, uint32 &uAxis, uint32 &vAxis)
+{
+  switch(plane)
+  {
+  case WasmNoise::SquarePlane::XYPlane: uAxis = 0; vAxis = 1; break;
+  case WasmNoise::SquarePlane::XZPlane: uAxis = 0; vAxis = 2; break;
+  case WasmNoise::SquarePlane::ZYPlane: uAxis = 2; vAxis = 1; break;
+  case WasmNoise::SquarePlane::XWPlane: uAxis = 0; vAxis = 3; break;
+  case WasmNoise::SquarePlane::YWPlane: uAxis = 1; vAxis = 3; break;
+  case WasmNoise::SquarePlane::ZWPlane: uAxis = 2; vAxis = 3; break;
+  default: return false;
+  }
+  return uAxis < dimensions && vAxis < dimensions;
+}
+
+// End Single Noise Function Section *******************************
+
+// Public White Noise Functions
+
+// 2D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y)
+{
+  return SingleWhite(x * frequency, y * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel2D<&WasmNoise::SingleWhite>(), length, direction, startX, startY);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height)
+{
+  return GetSquare(Kernel2D<&WasmNoise::SingleWhite>(), width, height, startX, startY);
+}
+
+// 3D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z)
+{
+  return SingleWhite(x * frequency, y * frequency, z * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel3D<&WasmNoise::SingleWhite>(), length, direction, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  return GetSquare(Kernel3D<&WasmNoise::SingleWhite>(), width, height, plane, startX, startY, startZ);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth)
+{
+  return GetCube(Kernel3D<&WasmNoise::SingleWhite>(), width, height, depth, startX, startY, startZ);
+}
+
+// 4D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w)
+{
+  return SingleWhite(x * frequency, y * frequency, z * frequency, w * frequency);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction)
+{
+  return GetStrip(Kernel4D<&WasmNoise::SingleWhite>(), length, direction, startX, startY, startZ, startW);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane)
+{
+  return GetSquare(Kernel4D<&WasmNoise::SingleWhite>(), width, height, plane, startX, startY, startZ, startW);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth)
+{
+  return GetCube(Kernel4D<&WasmNoise::SingleWhite>(), width, height, depth, startX, startY, startZ, startW);
+}
+
+// Points
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoisePoints(const WN_DECIMAL *coords, uint32 count, uint32 dimensions)
+{
+  switch(dimensions)
+  {
+  case 2:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 2)
+    {
+      values[i] = Remap(SingleWhite(coords[0] * frequency, coords[1] * frequency));
+    }
+    return values;
+  }
+  case 3:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 3)
+    {
+      values[i] = Remap(SingleWhite(coords[0] * frequency, coords[1] * frequency, coords[2] * frequency));
+    }
+    return values;
+  }
+  case 4:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 4)
+    {
+      values[i] = Remap(SingleWhite(coords[0] * frequency, coords[1] * frequency, coords[2] * frequency, coords[3] * frequency));
+    }
+    return values;
+  }
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
+
+// Integer coordinates, frequency is not applied
+// 2D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoiseInt(int32 x, int32 y) const
+{
+  return ValCoord2D(seed, x, y);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntStrip(int32 startX, int32 startY, uint32 length, StripDirection direction)
+{
+  const int32 start[] = { startX, startY };
+  uint32 axis = static_cast<uint32>(direction);
+  if(axis >= 2)
+  {
+    ABORT();
+    return nullptr;
+  }
+  return GetWhiteIntGrid(start, 2, axis, length, 2, 1, 2, 1);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntSquare(int32 startX, int32 startY, uint32 width, uint32 height)
+{
+  const int32 start[] = { startX, startY };
+  return GetWhiteIntGrid(start, 2, 0, width, 1, height, 2, 1);
+}
+
+// 3D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoiseInt(int32 x, int32 y, int32 z) const
+{
+  return ValCoord3D(seed, x, y, z);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntStrip(int32 startX, int32 startY, int32 startZ, uint32 length, StripDirection direction)
+{
+  const int32 start[] = { startX, startY, startZ };
+  uint32 axis = static_cast<uint32>(direction);
+  if(axis >= 3)
+  {
+    ABORT();
+    return nullptr;
+  }
+  return GetWhiteIntGrid(start, 3, axis, length, 3, 1, 3, 1);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntSquare(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, SquarePlane plane)
+{
+  const int32 start[] = { startX, startY, startZ };
+  uint32 uAxis, vAxis;
+  if(!GetPlaneAxes(plane, 3, uAxis, vAxis))
+  {
+    ABORT();
+    return nullptr;
+  }
+  return GetWhiteIntGrid(start, 3, uAxis, width, vAxis, height, 3, 1);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntCube(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, uint32 depth)
+{
+  const int32 start[] = { startX, startY, startZ };
+  return GetWhiteIntGrid(start, 3, 0, width, 1, height, 2, depth);
+}
+
+// 4D
+WN_INLINE WN_DECIMAL WasmNoise::GetWhiteNoiseInt(int32 x, int32 y, int32 z, int32 w) const
+{
+  return ValCoord4D(seed, x, y, z, w);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntStrip(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 length, StripDirection direction)
+{
+  const int32 start[] = { startX, startY, startZ, startW };
+  uint32 axis = static_cast<uint32>(direction);
+  if(axis >= 4)
+  {
+    ABORT();
+    return nullptr;
+  }
+  return GetWhiteIntGrid(start, 4, axis, length, 4, 1, 4, 1);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntSquare(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, SquarePlane plane)
+{
+  const int32 start[] = { startX, startY, startZ, startW };
+  uint32 uAxis, vAxis;
+  if(!GetPlaneAxes(plane, 4, uAxis, vAxis))
+  {
+    ABORT();
+    return nullptr;
+  }
+  return GetWhiteIntGrid(start, 4, uAxis, width, vAxis, height, 4, 1);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntCube(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, uint32 depth)
+{
+  const int32 start[] = { startX, startY, startZ, startW };
+  return GetWhiteIntGrid(start, 4, 0, width, 1, height, 2, depth);
+}
+
+// Points
+WN_INLINE WN_DECIMAL *WasmNoise::GetWhiteNoiseIntPoints(const int32 *coords, uint32 count, uint32 dimensions)
+{
+  switch(dimensions)
+  {
+  case 2:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 2)
+    {
+      values[i] = Remap(ValCoord2D(seed, coords[0], coords[1]));
+    }
+    return values;
+  }
+  case 3:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 3)
+    {
+      values[i] = Remap(ValCoord3D(seed, coords[0], coords[1], coords[2]));
+    }
+    return values;
+  }
+  case 4:
+  {
+    WN_DECIMAL *values = returnHelper.NewArray(count);
+    for(uint32 i = 0; i < count; i++, coords += 4)
+    {
+      values[i] = Remap(ValCoord4D(seed, coords[0], coords[1], coords[2], coords[3]));
+    }
+    return values;
+  }
+  default:
+    ABORT();
+    return nullptr;
+  }
+}
@@ -13,6 +13,24 @@
 #if defined(WN_INCLUDE_CELLULAR) || defined(WN_INCLUDE_CELLULAR_FRACTAL)
 #include "WasmNoise.Cellular.hpp"
 #endif // WN_INCLUDE_CELLULAR
+#if defined(WN_INCLUDE_VALUE) || defined(WN_INCLUDE_VALUE_FRACTAL)
+#include "WasmNoise.Value.hpp"
+#endif // WN_INCLUDE_VALUE || WN_INCLUDE_VALUE_FRACTAL
+#if defined(WN_INCLUDE_CUBIC) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+#include "WasmNoise.Cubic.hpp"
+#endif // WN_INCLUDE_CUBIC || WN_INCLUDE_CUBIC_FRACTAL
+#ifdef WN_INCLUDE_WHITE
+#include "WasmNoise.White.hpp"
+#endif // WN_INCLUDE_WHITE
+#ifdef WN_INCLUDE_VIEWPORT
+#include "WasmNoise.Viewport.hpp"
+#endif // WN_INCLUDE_VIEWPORT
+#ifdef WN_INCLUDE_GRAPH
+#include "WasmNoise.Graph.hpp"
+#endif // WN_INCLUDE_GRAPH
+#ifdef WN_INCLUDE_MESH
+#include "WasmNoise.Mesh.hpp"
+#endif // WN_INCLUDE_MESH
 
 void WasmNoise::SetSeed(int32 _seed)
 {
@@ -36,6 +54,94 @@ void WasmNoise::SetSeed(int32 _seed)
   }
 }
 
+void WasmNoise::SetSampleStep(WN_DECIMAL _sampleStepX, WN_DECIMAL _sampleStepY, WN_DECIMAL _sampleStepZ, WN_DECIMAL _sampleStepW)
+{
+  sampleStepX = _sampleStepX;
+  sampleStepY = _sampleStepY;
+  sampleStepZ = _sampleStepZ;
+  sampleStepW = _sampleStepW;
+}
+
+void WasmNoise::SetOutputTarget(WN_DECIMAL *dest, uint32 pitch, uint32 rows, uint32 offsetX, uint32 offsetY)
+{
+  outputTarget = dest;
+  outputTargetPitch = pitch;
+  outputTargetRows = rows;
+  outputTargetX = offsetX;
+  outputTargetY = offsetY;
+}
+
+void WasmNoise::SetSampleMask(const uint32 *mask, WN_DECIMAL fill)
+{
+  sampleMask = mask;
+  sampleMaskFill = fill;
+}
+
+void WasmNoise::SetPeriod(int32 _periodX, int32 _periodY, int32 _periodZ)
+{
+  periodX = max(_periodX, 0);
+  periodY = max(_periodY, 0);
+  periodZ = max(_periodZ, 0);
+  CalculateLatticeOctaves();
+}
+
+void WasmNoise::SetChunkOrigin(int32 chunkX, int32 chunkY, int32 chunkZ, int32 chunkCells)
+{
+  // Fractals couldn't scale the origin to line up with their octaves
+  if(WholeLacunarity() == 0)
+  {
+    ABORT();
+    return;
+  }
+
+  latticeOriginX = chunkX * chunkCells;
+  latticeOriginY = chunkY * chunkCells;
+  latticeOriginZ = chunkZ * chunkCells;
+  CalculateLatticeOctaves();
+}
+
+void WasmNoise::ClearChunkOrigin()
+{
+  latticeOriginX = latticeOriginY = latticeOriginZ = 0;
+  CalculateLatticeOctaves();
+}
+
+void WasmNoise::SetCubeSubsample(uint32 _subsampleX, uint32 _subsampleY, uint32 _subsampleZ)
+{
+  cubeSubsampleX = max(_subsampleX, 1u);
+  cubeSubsampleY = max(_subsampleY, 1u);
+  cubeSubsampleZ = max(_subsampleZ, 1u);
+}
+
+void WasmNoise::SetAdaptiveTolerance(WN_DECIMAL _adaptiveTolerance)
+{
+  adaptiveTolerance = max(_adaptiveTolerance, WN_DECIMAL(0));
+}
+
+void WasmNoise::SetRemapLUT(const WN_DECIMAL *lut, uint32 count)
+{
+  ClearRemap();
+  if(lut == nullptr || count < 2)
+  {
+    return;
+  }
+
+  remapLUT = new WN_DECIMAL[count];
+  for(uint32 i = 0; i < count; i++)
+  {
+    remapLUT[i] = lut[i];
+  }
+  remapLUTCount = count;
+  remapLUTScale = WN_DECIMAL(count - 1) / 2;
+}
+
+void WasmNoise::ClearRemap()
+{
+  if(remapLUT) delete[] remapLUT;
+  remapLUT = nullptr;
+  remapLUTCount = 0;
+}
+
 void WasmNoise::CalculateFractalBounding()
 {
   WN_DECIMAL amp = fractalGain;
@@ -60,56 +166,380 @@ void WasmNoise::CalculateFractalExponents()
   }
 }
 
+void WasmNoise::CalculateLatticeOctaves()
+{
+  latticeShifted = HasChunkOrigin() || (periodX | periodY | periodZ) != 0;
+
+  // Fractals couldn't scale the origin to line up with their octaves
+  int32 lacunarity = WholeLacunarity();
+  if(HasChunkOrigin() && lacunarity == 0)
+  {
+    ABORT();
+  }
+
+  if(latticeOctaves) delete[] latticeOctaves;
+  latticeOctaves = new LatticeOctave[fractalOctaves + 1];
+  LatticeOctave octave = { latticeOriginX, latticeOriginY, latticeOriginZ, periodX, periodY, periodZ };
+  for(uint32 i = 0; i <= fractalOctaves; i++)
+  {
+    latticeOctaves[i] = octave;
+    if(lacunarity != 0)
+    {
+      octave.originX *= lacunarity;
+      octave.originY *= lacunarity;
+      octave.originZ *= lacunarity;
+      octave.periodX *= lacunarity;
+      octave.periodY *= lacunarity;
+      octave.periodZ *= lacunarity;
+    }
+  }
+  lattice = latticeOctaves;
+}
+
 // Index Functions
-WN_INLINE uint8 WasmNoise::Index2D_12(uint8 offset, int32 x, int32 y) const
+// Shifted lattice coordinates are moved to the current octave's chunk origin and then wrapped to its 
+// period (if any) before hashing, so the noise repeats every period cells along that axis
+template<bool Shifted> WN_INLINE int32 WasmNoise::LatticeX(int32 x) const { return Shifted ? WrapPeriod(x + lattice->originX, lattice->periodX) : x; }
+template<bool Shifted> WN_INLINE int32 WasmNoise::LatticeY(int32 y) const { return Shifted ? WrapPeriod(y + lattice->originY, lattice->periodY) : y; }
+template<bool Shifted> WN_INLINE int32 WasmNoise::LatticeZ(int32 z) const { return Shifted ? WrapPeriod(z + lattice->originZ, lattice->periodZ) : z; }
+
+#ifdef WN_USE_HASH_LATTICE
+// Each corner is hashed from its coordinates with independent multiplies instead of a chain of 
+// dependent table lookups, and the noise no longer repeats every 256 cells
+WN_INLINE int32 WasmNoise::LatticeSeed(uint8 offset) const
+{
+  return seed ^ (OffsetPrime * offset);
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index2D_12(uint8 offset, int32 x, int32 y) const
+{
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y))) % 12;
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const
+{
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y)) ^ (ZPrime * LatticeZ<Shifted>(z))) % 12;
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y)) ^ (ZPrime * LatticeZ<Shifted>(z)) ^ (WPrime * w)) & 31;
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index2D_256(uint8 offset, int32 x, int32 y) const
+{
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y))) & 0xff;
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const
+{
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y)) ^ (ZPrime * LatticeZ<Shifted>(z))) & 0xff;
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
 {
-  return perm12[(x & 0xff) + perm[(y & 0xff) + offset]];
+  return LatticeHash(LatticeSeed(offset) ^ (XPrime * LatticeX<Shifted>(x)) ^ (YPrime * LatticeY<Shifted>(y)) ^ (ZPrime * LatticeZ<Shifted>(z)) ^ (WPrime * w)) & 0xff;
 }
 
-WN_INLINE uint8 WasmNoise::Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const
+// A row is the seed and Y (and Z) part of the hash, only the X term is left per sample
+template<bool Shifted> WN_INLINE WasmNoise::LatticeRow WasmNoise::RowLookup(uint8 offset, int32 y) const
+{
+  return LatticeSeed(offset) ^ (YPrime * LatticeY<Shifted>(y));
+}
+
+template<bool Shifted> WN_INLINE WasmNoise::LatticeRow WasmNoise::RowLookup(uint8 offset, int32 y, int32 z) const
+{
+  return LatticeSeed(offset) ^ (YPrime * LatticeY<Shifted>(y)) ^ (ZPrime * LatticeZ<Shifted>(z));
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::RowIndex_256(LatticeRow row, int32 x) const
+{
+  return LatticeHash(row ^ (XPrime * LatticeX<Shifted>(x))) & 0xff;
+}
+#else
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index2D_12(uint8 offset, int32 x, int32 y) const
 {
-  return perm12[(x & 0xff) + perm[(y & 0xff) + perm[(z & 0xff) + offset]]];
+  return perm12[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + offset]];
 }
 
-WN_INLINE uint8 WasmNoise::Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const
 {
-  return perm[(x & 0xff) + perm[(y & 0xff) + perm[(z & 0xff) + perm[(w & 0xff) + offset]]]] & 31;
+  return perm12[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + perm[(LatticeZ<Shifted>(z) & 0xff) + offset]]];
 }
 
-WN_INLINE uint8 WasmNoise::Index2D_256(uint8 offset, int32 x, int32 y) const
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
 {
-  return perm[(x & 0xff) + perm[(y & 0xff) + offset]];
+  return perm[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + perm[(LatticeZ<Shifted>(z) & 0xff) + perm[(w & 0xff) + offset]]]] & 31;
 }
 
-WN_INLINE uint8 WasmNoise::Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index2D_256(uint8 offset, int32 x, int32 y) const
 {
-  return perm[(x & 0xff) + perm[(y & 0xff) + perm[(z & 0xff) + offset]]];
+  return perm[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + offset]];
 }
 
-WN_INLINE uint8 WasmNoise::Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const
 {
-  return perm[(x & 0xff) + perm[(y & 0xff) + perm[(z & 0xff) + perm[(w & 0xff) + offset]]]];
+  return perm[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + perm[(LatticeZ<Shifted>(z) & 0xff) + offset]]];
 }
 
+template<bool Shifted> WN_INLINE uint8 WasmNoise::Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+  return perm[(LatticeX<Shifted>(x) & 0xff) + perm[(LatticeY<Shifted>(y) & 0xff) + perm[(LatticeZ<Shifted>(z) & 0xff) + perm[(w & 0xff) + offset]]]];
+}
+
+// A row is the permutation table row reached after the Y (and Z) lookups
+template<bool Shifted> WN_INLINE WasmNoise::LatticeRow WasmNoise::RowLookup(uint8 offset, int32 y) const
+{
+  return perm + perm[(LatticeY<Shifted>(y) & 0xff) + offset];
+}
+
+template<bool Shifted> WN_INLINE WasmNoise::LatticeRow WasmNoise::RowLookup(uint8 offset, int32 y, int32 z) const
+{
+  return perm + perm[(LatticeY<Shifted>(y) & 0xff) + perm[(LatticeZ<Shifted>(z) & 0xff) + offset]];
+}
+
+template<bool Shifted> WN_INLINE uint8 WasmNoise::RowIndex_256(LatticeRow row, int32 x) const
+{
+  return row[LatticeX<Shifted>(x) & 0xff];
+}
+#endif // WN_USE_HASH_LATTICE
+
 // Gradient Coordinate Functions
-WN_INLINE WN_DECIMAL WasmNoise::GradCoord2D(uint8 offset, int32 x, int32 y, WN_DECIMAL xd, WN_DECIMAL yd) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::GradCoord2D(uint8 offset, int32 x, int32 y, WN_DECIMAL xd, WN_DECIMAL yd) const
 {
-  uint8 lutPos = Index2D_12(offset, x, y);
+  uint8 lutPos = Index2D_12<Shifted>(offset, x, y);
   return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos];
 }
 
-WN_INLINE WN_DECIMAL WasmNoise::GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd) const
 {
-  uint8 lutPos = Index3D_12(offset, x, y, z);
+  uint8 lutPos = Index3D_12<Shifted>(offset, x, y, z);
   return xd*GRAD_X[lutPos] + yd*GRAD_Y[lutPos] + zd*GRAD_Z[lutPos];
 }
 
-WN_INLINE WN_DECIMAL WasmNoise::GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd, WN_DECIMAL wd) const
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd, WN_DECIMAL wd) const
 {
-  uint8 lutPos = Index4D_32(offset, x, y, z, w) << 2;
+  uint8 lutPos = Index4D_32<Shifted>(offset, x, y, z, w) << 2;
   return xd*GRAD_4D[lutPos] + yd*GRAD_4D[lutPos + 1] + zd*GRAD_4D[lutPos + 2] + wd*GRAD_4D[lutPos + 3];
 }
 
+// Value Coordinate Functions
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::ValCoord2DFast(uint8 offset, int32 x, int32 y) const
+{
+  return ValFromIndex(Index2D_256<Shifted>(offset, x, y));
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const
+{
+  return ValFromIndex(Index3D_256<Shifted>(offset, x, y, z));
+}
+
+template<bool Shifted> WN_INLINE WN_DECIMAL WasmNoise::ValCoord4DFast(uint8 offset, int32 x, int32 y, int32 z, int32 w) const
+{
+  return ValFromIndex(Index4D_256<Shifted>(offset, x, y, z, w));
+}
+
+// Remap Functions
+WN_INLINE WN_DECIMAL WasmNoise::Remap(WN_DECIMAL value) const
+{
+  if(remapLUT == nullptr)
+  {
+    return value;
+  }
+
+  WN_DECIMAL t = (value + 1) * remapLUTScale;
+  Clamp(t, 0, WN_DECIMAL(remapLUTCount - 1));
+  uint32 i = min(static_cast<uint32>(t), remapLUTCount - 2);
+  return Lerp(remapLUT[i], remapLUT[i + 1], t - i);
+}
+
+// Output Layout Functions
+WN_INLINE bool WasmNoise::IsValidLayout(uint32 width, uint32 height, uint32 depth) const
+{
+  if(outputTarget != nullptr)
+  {
+    // The block has to fit inside the destination, slices are stacked below each other
+    return outputLayout == OutputLayout::RowMajor
+      && uint64(outputTargetX) + width <= outputTargetPitch
+      && uint64(outputTargetY) + uint64(height) * depth <= outputTargetRows;
+  }
+
+  switch(outputLayout)
+  {
+  case OutputLayout::RowMajor:
+  case OutputLayout::YZX:
+    return true;
+  case OutputLayout::Morton:
+    return width && height && depth && (width & (width - 1)) == 0 && (height & (height - 1)) == 0 && (depth & (depth - 1)) == 0;
+  case OutputLayout::Brick:
+    return width % BrickSize == 0 && height % BrickSize == 0 && (depth == 1 || depth % BrickSize == 0);
+  default:
+    return false;
+  }
+}
+
+WN_INLINE uint32 WasmNoise::LayoutSize(uint32 width, uint32 height, uint32 depth) const
+{
+  if(outputLayout == OutputLayout::RowMajor)
+  {
+    return LayoutRowStride(width) * height * depth;
+  }
+  return width * height * depth;
+}
+
+WN_INLINE uint32 WasmNoise::LayoutRowStride(uint32 width) const
+{
+  return (outputTarget != nullptr) ? outputTargetPitch : max(width, outputRowStride);
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::NewOutput(uint32 width, uint32 height, uint32 depth)
+{
+  if(outputTarget != nullptr)
+  {
+    return outputTarget + (outputTargetPitch * outputTargetY) + outputTargetX;
+  }
+  return returnHelper.NewArray(LayoutSize(width, height, depth));
+}
+
+WN_INLINE uint32 WasmNoise::LayoutOffset(uint32 axis, uint32 i, uint32 width, uint32 height, uint32 depth) const
+{
+  switch(outputLayout)
+  {
+  case OutputLayout::RowMajor:
+  {
+    uint32 rowStride = LayoutRowStride(width);
+    return i * (axis == 0 ? 1 : axis == 1 ? rowStride : rowStride * height);
+  }
+  case OutputLayout::YZX:
+    return i * (axis == 1 ? 1 : axis == 2 ? height : height * depth);
+  case OutputLayout::Morton:
+  {
+    // Bits are interleaved x, y, z from the lowest up, an axis stops taking part once its bits run 
+    // out so non-cubic power of two blocks still pack densely
+    const uint32 bits[3] = { uint32(__builtin_ctz(width)), uint32(__builtin_ctz(height)), uint32(__builtin_ctz(depth)) };
+    uint32 offset = 0;
+    for(uint32 b = 0; (i >> b) != 0; b++)
+    {
+      if((i >> b) & 1)
+      {
+        uint32 position = 0;
+        for(uint32 a = 0; a < 3; a++)
+        {
+          position += min(b, bits[a]) + ((a < axis && bits[a] > b) ? 1 : 0);
+        }
+        offset |= 1u << position;
+      }
+    }
+    return offset;
+  }
+  case OutputLayout::Brick:
+  {
+    uint32 brickVolume = BrickSize * BrickSize * (depth == 1 ? 1 : BrickSize);
+    uint32 brick = i / BrickSize;
+    uint32 local = i % BrickSize;
+    switch(axis)
+    {
+    case 0: return (brick * brickVolume) + local;
+    case 1: return (brick * (width / BrickSize) * brickVolume) + (local * BrickSize);
+    default: return (brick * (width / BrickSize) * (height / BrickSize) * brickVolume) + (local * BrickSize * BrickSize);
+    }
+  }
+  default:
+    return 0;
+  }
+}
+
+WN_INLINE const uint32 *WasmNoise::ColumnOffsets(uint32 width, uint32 height)
+{
+  uint32 *offsets = offsetHelper.NewArray(width);
+  for(uint32 x = 0; x < width; x++)
+  {
+    offsets[x] = LayoutOffset(0, x, width, height, 1);
+  }
+  return offsets;
+}
+
+WN_INLINE WN_DECIMAL *WasmNoise::UpsampleCube(const WN_DECIMAL *coarse, uint32 width, uint32 height, uint32 depth)
+{
+  uint32 coarseWidth = CoarseCount(width, cubeSubsampleX);
+  uint32 coarseHeight = CoarseCount(height, cubeSubsampleY);
+  uint32 coarseDepth = CoarseCount(depth, cubeSubsampleZ);
+  uint32 coarseSlice = coarseWidth * coarseHeight;
+
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  for(uint32 z = 0; z < depth; z++)
+  {
+    uint32 cz = z / cubeSubsampleZ;
+    WN_DECIMAL tz = static_cast<WN_DECIMAL>(z % cubeSubsampleZ) / static_cast<WN_DECIMAL>(cubeSubsampleZ);
+    const WN_DECIMAL *slice0 = coarse + cz * coarseSlice;
+    const WN_DECIMAL *slice1 = coarse + min(cz + 1, coarseDepth - 1) * coarseSlice;
+    uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+    for(uint32 y = 0; y < height; y++)
+    {
+      uint32 cy = y / cubeSubsampleY;
+      WN_DECIMAL ty = static_cast<WN_DECIMAL>(y % cubeSubsampleY) / static_cast<WN_DECIMAL>(cubeSubsampleY);
+      uint32 row0 = cy * coarseWidth;
+      uint32 row1 = min(cy + 1, coarseHeight - 1) * coarseWidth;
+      WN_DECIMAL *row = values + zOffset + LayoutOffset(1, y, width, height, depth);
+      for(uint32 x = 0; x < width; x++)
+      {
+        uint32 x0 = x / cubeSubsampleX;
+        uint32 x1 = min(x0 + 1, coarseWidth - 1);
+        WN_DECIMAL tx = static_cast<WN_DECIMAL>(x % cubeSubsampleX) / static_cast<WN_DECIMAL>(cubeSubsampleX);
+
+        WN_DECIMAL xf00 = Lerp(slice0[row0 + x0], slice0[row0 + x1], tx);
+        WN_DECIMAL xf10 = Lerp(slice0[row1 + x0], slice0[row1 + x1], tx);
+        WN_DECIMAL xf01 = Lerp(slice1[row0 + x0], slice1[row0 + x1], tx);
+        WN_DECIMAL xf11 = Lerp(slice1[row1 + x0], slice1[row1 + x1], tx);
+        row[LayoutOffset(0, x, width, height, depth)] = Remap(Lerp(Lerp(xf00, xf10, ty), Lerp(xf01, xf11, ty), tz));
+      }
+    }
+  }
+  return values;
+}
+
+// Sample Mask Functions
+WN_INLINE uint32 WasmNoise::CompactMask(uint32 &next, uint32 count, uint32 *indices) const
+{
+  uint32 found = 0;
+  while(next < count && found < MaskChunkLength)
+  {
+    uint32 word = sampleMask[next >> 5] >> (next & 31);
+    if(word == 0)
+    {
+      next = (next | 31) + 1;
+      continue;
+    }
+    next += __builtin_ctz(word);
+    if(next < count)
+    {
+      indices[found++] = next++;
+    }
+  }
+  next = min(next, count);
+  return found;
+}
+
+WN_INLINE void WasmNoise::FillUnmasked(WN_DECIMAL *values, uint32 width, uint32 height, uint32 depth) const
+{
+  uint32 i = 0;
+  for(uint32 z = 0; z < depth; z++)
+  {
+    uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+    for(uint32 y = 0; y < height; y++)
+    {
+      WN_DECIMAL *row = values + zOffset + LayoutOffset(1, y, width, height, depth);
+      for(uint32 x = 0; x < width; x++, i++)
+      {
+        if(!IsMasked(i))
+        {
+          row[LayoutOffset(0, x, width, height, depth)] = sampleMaskFill;
+        }
+      }
+    }
+  }
+}
+
 // Base Array Functions
 
 // 2D Strip
@@ -123,7 +553,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, (startX+i) * frequency, startY * frequency);
+      values[i] = Remap(invoke(func, *this, (startX + i*sampleStepX) * frequency, startY * frequency));
     }
     return values;
   }
@@ -132,7 +562,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, (startY+i) * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, (startY + i*sampleStepY) * frequency));
     }
     return values;
   }
@@ -153,7 +583,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, (startX+i) * frequency, startY * frequency, startZ * frequency);
+      values[i] = Remap(invoke(func, *this, (startX + i*sampleStepX) * frequency, startY * frequency, startZ * frequency));
     }
     return values;
   }
@@ -162,7 +592,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);    
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, (startY+i) * frequency, startZ * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, (startY + i*sampleStepY) * frequency, startZ * frequency));
     }
     return values;
   }
@@ -171,7 +601,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);    
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, startY * frequency, (startZ+i) * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, startY * frequency, (startZ + i*sampleStepZ) * frequency));
     }
     return values;
   }
@@ -192,7 +622,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, (startX+i) * frequency, startY * frequency, startZ * frequency, startW * frequency);
+      values[i] = Remap(invoke(func, *this, (startX + i*sampleStepX) * frequency, startY * frequency, startZ * frequency, startW * frequency));
     }
     return values;
   }
@@ -201,7 +631,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, (startY+i) * frequency, startZ * frequency, startW * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, (startY + i*sampleStepY) * frequency, startZ * frequency, startW * frequency));
     }
     return values;
   }
@@ -210,7 +640,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, startY * frequency, (startZ+i) * frequency, startW * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, startY * frequency, (startZ + i*sampleStepZ) * frequency, startW * frequency));
     }
     return values;
   }
@@ -219,7 +649,7 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
     WN_DECIMAL *values = returnHelper.NewArray(length);
     for(uint32 i = 0; i < length; i++)
     {
-      values[i] = invoke(func, *this, startX * frequency, startY * frequency, startZ * frequency, (startW+i) * frequency);
+      values[i] = Remap(invoke(func, *this, startX * frequency, startY * frequency, startZ * frequency, (startW + i*sampleStepW) * frequency));
     }
     return values;
   }
@@ -233,55 +663,231 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetStrip(NoiseFunc func, uint32 length, StripDi
 template<class NoiseFunc> 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY)
 {
-  WN_DECIMAL *values = returnHelper.NewArray(width*height);
+  if(!IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  if(sampleMask != nullptr)
+  {
+    return GetMaskedSquare(func, width, height, startX, startY);
+  }
+  if(adaptiveTolerance > 0)
+  {
+    return GetAdaptiveSquare(func, width, height, startX, startY);
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  const uint32 *columnOffsets = ColumnOffsets(width, height);
   for(uint32 y = 0; y < height; y++)
   {
+    WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
     for(uint32 x = 0; x < width; x++)
     {
-      values[(width*y) + x] = invoke(func, *this, (startX+x) * frequency, (startY+y) * frequency);
+      row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency));
     }
   }
   return values;
 }
 
+// 2D Square (Masked)
+// The set samples are gathered MaskChunkLength at a time along with their coordinates, then evaluated 
+// in one tight loop
+template<class NoiseFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetMaskedSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  FillUnmasked(values, width, height, 1);
+
+  uint32 indices[MaskChunkLength];
+  WN_DECIMAL xCoords[MaskChunkLength];
+  WN_DECIMAL yCoords[MaskChunkLength];
+  uint32 offsets[MaskChunkLength];
+  uint32 next = 0;
+  while(next < width * height)
+  {
+    uint32 count = CompactMask(next, width * height, indices);
+    for(uint32 i = 0; i < count; i++)
+    {
+      uint32 x = indices[i] % width;
+      uint32 y = indices[i] / width;
+      xCoords[i] = (startX + x*sampleStepX) * frequency;
+      yCoords[i] = (startY + y*sampleStepY) * frequency;
+      offsets[i] = LayoutOffset(1, y, width, height, 1) + LayoutOffset(0, x, width, height, 1);
+    }
+    for(uint32 i = 0; i < count; i++)
+    {
+      values[offsets[i]] = Remap(invoke(func, *this, xCoords[i], yCoords[i]));
+    }
+  }
+  return values;
+}
+
+// 2D Square (Adaptive)
+// The square is covered by blocks of AdaptiveBlockSize samples sharing their corner samples. A block
+// evaluates its corners, then its centre and edge midpoints one at a time, and is split in four as
+// soon as one of them is further than the tolerance from the bilinear interpolation of the corners
+// Blocks passing the test interpolate their samples which haven't been evaluated
+template<class NoiseFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetAdaptiveSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  AdaptiveGrid grid = { coarseHelper.NewArray(width * height), knownHelper.NewArray(width * height), width, startX, startY };
+  for(uint32 i = 0; i < width * height; i++)
+  {
+    grid.known[i] = 0;
+  }
+  adaptiveSampleCount = 0;
+
+  for(uint32 y0 = 0; y0 < height; y0 += AdaptiveBlockSize)
+  {
+    uint32 y1 = min(y0 + AdaptiveBlockSize, height - 1);
+    for(uint32 x0 = 0; x0 < width; x0 += AdaptiveBlockSize)
+    {
+      RefineAdaptiveBlock(func, grid, x0, y0, min(x0 + AdaptiveBlockSize, width - 1), y1);
+    }
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  const uint32 *columnOffsets = ColumnOffsets(width, height);
+  for(uint32 y = 0; y < height; y++)
+  {
+    WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
+    for(uint32 x = 0; x < width; x++)
+    {
+      row[columnOffsets[x]] = Remap(grid.values[y * width + x]);
+    }
+  }
+  return values;
+}
+
+template<class NoiseFunc>
+void WasmNoise::RefineAdaptiveBlock(NoiseFunc func, AdaptiveGrid &grid, uint32 x0, uint32 y0, uint32 x1, uint32 y1)
+{
+  WN_DECIMAL v00 = AdaptiveSample(func, grid, x0, y0);
+  WN_DECIMAL v10 = AdaptiveSample(func, grid, x1, y0);
+  WN_DECIMAL v01 = AdaptiveSample(func, grid, x0, y1);
+  WN_DECIMAL v11 = AdaptiveSample(func, grid, x1, y1);
+  if(x1 - x0 <= 1 && y1 - y0 <= 1)
+  {
+    return;
+  }
+
+  WN_DECIMAL spanX = static_cast<WN_DECIMAL>(max(x1 - x0, 1u));
+  WN_DECIMAL spanY = static_cast<WN_DECIMAL>(max(y1 - y0, 1u));
+  uint32 mx = (x0 + x1) / 2;
+  uint32 my = (y0 + y1) / 2;
+  const uint32 testX[5] = { mx, mx, mx, x0, x1 };
+  const uint32 testY[5] = { my, y0, y1, my, my };
+  bool smooth = true;
+  for(uint32 i = 0; i < 5 && smooth; i++)
+  {
+    WN_DECIMAL tx = static_cast<WN_DECIMAL>(testX[i] - x0) / spanX;
+    WN_DECIMAL ty = static_cast<WN_DECIMAL>(testY[i] - y0) / spanY;
+    WN_DECIMAL predicted = Lerp(Lerp(v00, v10, tx), Lerp(v01, v11, tx), ty);
+    smooth = FastAbs(AdaptiveSample(func, grid, testX[i], testY[i]) - predicted) <= adaptiveTolerance;
+  }
+
+  if(!smooth)
+  {
+    // Axes spanning a single cell aren't split any further
+    uint32 splitX = x1 - x0 > 1 ? mx : x1;
+    uint32 splitY = y1 - y0 > 1 ? my : y1;
+    RefineAdaptiveBlock(func, grid, x0, y0, splitX, splitY);
+    if(splitX != x1)
+    {
+      RefineAdaptiveBlock(func, grid, splitX, y0, x1, splitY);
+    }
+    if(splitY != y1)
+    {
+      RefineAdaptiveBlock(func, grid, x0, splitY, splitX, y1);
+    }
+    if(splitX != x1 && splitY != y1)
+    {
+      RefineAdaptiveBlock(func, grid, splitX, splitY, x1, y1);
+    }
+    return;
+  }
+
+  for(uint32 y = y0; y <= y1; y++)
+  {
+    WN_DECIMAL ty = static_cast<WN_DECIMAL>(y - y0) / spanY;
+    WN_DECIMAL left = Lerp(v00, v01, ty);
+    WN_DECIMAL right = Lerp(v10, v11, ty);
+    for(uint32 x = x0; x <= x1; x++)
+    {
+      uint32 i = y * grid.width + x;
+      if(!grid.known[i])
+      {
+        grid.values[i] = Lerp(left, right, static_cast<WN_DECIMAL>(x - x0) / spanX);
+      }
+    }
+  }
+}
+
+template<class NoiseFunc>
+WN_INLINE WN_DECIMAL WasmNoise::AdaptiveSample(NoiseFunc func, AdaptiveGrid &grid, uint32 x, uint32 y)
+{
+  uint32 i = y * grid.width + x;
+  if(!grid.known[i])
+  {
+    grid.values[i] = invoke(func, *this, (grid.startX + x*sampleStepX) * frequency, (grid.startY + y*sampleStepY) * frequency);
+    grid.known[i] = 1;
+    adaptiveSampleCount++;
+  }
+  return grid.values[i];
+}
+
 // 3D Square
 template<class NoiseFunc> 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
 {
+  if(!IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
   switch(plane)
   {
   case SquarePlane::XYPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);
+    WN_DECIMAL *values = NewOutput(width, height, 1);
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 y = 0; y < height; y++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
       for(uint32 x = 0; x < width; x++)
       {
-        values[(width*y) + x] = invoke(func, *this, (startX+x) * frequency, (startY+y) * frequency, startZ * frequency);
+        row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency, startZ * frequency));
       }
     }
     return values;
   }
   case SquarePlane::XZPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);
+    WN_DECIMAL *values = NewOutput(width, height, 1);
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 z = 0; z < height; z++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, z, width, height, 1);
       for(uint32 x = 0; x < width; x++)
       {
-        values[(width*z) + x] = invoke(func, *this, (startX+x) * frequency, startY * frequency, (startZ+z) * frequency);
+        row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, startY * frequency, (startZ + z*sampleStepZ) * frequency));
       }
     }
     return values;
   }
   case SquarePlane::ZYPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);
+    WN_DECIMAL *values = NewOutput(width, height, 1);
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 y = 0; y < height; y++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
       for(uint32 z = 0; z < width; z++)
       {
-        values[(width*y) + z] = invoke(func, *this, startX * frequency, (startY+y) * frequency, (startZ+z) * frequency);
+        row[columnOffsets[z]] = Remap(invoke(func, *this, startX * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency));
       }
     }
     return values;
@@ -296,76 +902,94 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSquare(NoiseFunc func, uint32 width, uint32
 template<class NoiseFunc> 
 WN_INLINE WN_DECIMAL *WasmNoise::GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW)
 {
+  if(!IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
   switch(plane)
   {
   case SquarePlane::XYPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);    
+    WN_DECIMAL *values = NewOutput(width, height, 1);    
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 y = 0; y < height; y++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
       for(uint32 x = 0; x < width; x++)
       {
-        values[(width * y) + x] = invoke(func, *this, (startX+x) * frequency, (startY+y) * frequency, startZ * frequency, startW * frequency);
+        row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency, startZ * frequency, startW * frequency));
       }
     }
     return values;  
   }
   case SquarePlane::XZPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);        
+    WN_DECIMAL *values = NewOutput(width, height, 1);        
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 z = 0; z < height; z++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, z, width, height, 1);
       for(uint32 x = 0; x < width; x++)
       {
-        values[(width * z) + x] = invoke(func, *this, (startX+x) * frequency, startY * frequency, (startZ+z) * frequency, startW * frequency);
+        row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, startY * frequency, (startZ + z*sampleStepZ) * frequency, startW * frequency));
       }
     }
     return values;  
   }
   case SquarePlane::ZYPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);        
+    WN_DECIMAL *values = NewOutput(width, height, 1);        
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 y = 0; y < height; y++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, y, width, height, 1);
       for(uint32 z = 0; z < width; z++)
       {
-        values[(width * y) + z] = invoke(func, *this, startX * frequency, (startY+y) * frequency, (startZ+z) * frequency, startW * frequency);
+        row[columnOffsets[z]] = Remap(invoke(func, *this, startX * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency, startW * frequency));
       }
     }
     return values;  
   }
   case SquarePlane::XWPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);        
+    WN_DECIMAL *values = NewOutput(width, height, 1);        
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 w = 0; w < height; w++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, w, width, height, 1);
       for(uint32 x = 0; x < width; x++)
       {
-        values[(width * w) + x] = invoke(func, *this, (startX+x) * frequency, startY * frequency, startZ * frequency, (startW+w) * frequency);
+        row[columnOffsets[x]] = Remap(invoke(func, *this, (startX + x*sampleStepX) * frequency, startY * frequency, startZ * frequency, (startW + w*sampleStepW) * frequency));
       }
     }
     return values;  
   }
   case SquarePlane::YWPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);        
+    WN_DECIMAL *values = NewOutput(width, height, 1);        
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 w = 0; w < height; w++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, w, width, height, 1);
       for(uint32 y = 0; y < width; y++)
       {
-        values[(width * w) + y] = invoke(func, *this, startX * frequency, (startY+y) * frequency, startZ * frequency, (startW+w) * frequency);
+        row[columnOffsets[y]] = Remap(invoke(func, *this, startX * frequency, (startY + y*sampleStepY) * frequency, startZ * frequency, (startW + w*sampleStepW) * frequency));
       }
     }
     return values;  
   }
   case SquarePlane::ZWPlane:
   {
-    WN_DECIMAL *values = returnHelper.NewArray(width*height);        
+    WN_DECIMAL *values = NewOutput(width, height, 1);        
+    const uint32 *columnOffsets = ColumnOffsets(width, height);
     for(uint32 w = 0; w < height; w++)
     {
+      WN_DECIMAL *row = values + LayoutOffset(1, w, width, height, 1);
       for(uint32 z = 0; z < width; z++)
       {
-        values[(width * w) + z] = invoke(func, *this, startX * frequency, startY * frequency, (startZ+z) * frequency, (startW+w) * frequency);
+        row[columnOffsets[z]] = Remap(invoke(func, *this, startX * frequency, startY * frequency, (startZ + z*sampleStepZ) * frequency, (startW + w*sampleStepW) * frequency));
       }
     }
     return values;  
@@ -376,38 +1000,616 @@ WN_INLINE WN_DECIMAL *WasmNoise::GetSquare(NoiseFunc func, uint32 width, uint32
   }
 }
 
+// Cubes are generated in CubeTileSize x CubeTileSize columns running through the whole depth.
+// Neighbouring samples in a tile share lattice cells along X and Y, and the scaled X coordinates 
+// of a tile, along with their output offsets, are only computed once for every row and slice it covers.
+static constexpr uint32 CubeTileSize = 16;
+
 // 3D Cube
 template<class NoiseFunc> 
 WN_INLINE WN_DECIMAL *WasmNoise::GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
 {
-  WN_DECIMAL *values = returnHelper.NewArray(width*height*depth);
-  for(uint32 z = 0; z < depth; z++)
+  if(!IsValidLayout(width, height, depth))
   {
-    for(uint32 y = 0; y < height; y++)
+    ABORT();
+    return nullptr;
+  }
+
+  if(sampleMask != nullptr)
+  {
+    return GetMaskedCube(func, width, height, depth, startX, startY, startZ);
+  }
+  if(IsCubeSubsampled())
+  {
+    uint32 coarseWidth = CoarseCount(width, cubeSubsampleX);
+    uint32 coarseHeight = CoarseCount(height, cubeSubsampleY);
+    uint32 coarseDepth = CoarseCount(depth, cubeSubsampleZ);
+    WN_DECIMAL *coarse = coarseHelper.NewArray(coarseWidth * coarseHeight * coarseDepth);
+    uint32 i = 0;
+    for(uint32 z = 0; z < coarseDepth; z++)
+    {
+      WN_DECIMAL zCoord = (startZ + z*cubeSubsampleZ*sampleStepZ) * frequency;
+      for(uint32 y = 0; y < coarseHeight; y++)
+      {
+        WN_DECIMAL yCoord = (startY + y*cubeSubsampleY*sampleStepY) * frequency;
+        for(uint32 x = 0; x < coarseWidth; x++)
+        {
+          coarse[i++] = invoke(func, *this, (startX + x*cubeSubsampleX*sampleStepX) * frequency, yCoord, zCoord);
+        }
+      }
+    }
+    return UpsampleCube(coarse, width, height, depth);
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  WN_DECIMAL xCoords[CubeTileSize];
+  uint32 xOffsets[CubeTileSize];
+  for(uint32 tileY = 0; tileY < height; tileY += CubeTileSize)
+  {
+    uint32 tileHeight = min(height - tileY, CubeTileSize);
+    for(uint32 tileX = 0; tileX < width; tileX += CubeTileSize)
     {
-      for(uint32 x = 0; x < height; x++)
+      uint32 tileWidth = min(width - tileX, CubeTileSize);
+      for(uint32 x = 0; x < tileWidth; x++)
+      {
+        xCoords[x] = (startX + (tileX+x)*sampleStepX) * frequency;
+        xOffsets[x] = LayoutOffset(0, tileX+x, width, height, depth);
+      }
+
+      for(uint32 z = 0; z < depth; z++)
       {
-        values[(height * width * z) + (width * y) + x] = invoke(func, *this, (startX+x) * frequency, (startY+y) * frequency, (startZ+z) * frequency);
+        WN_DECIMAL zCoord = (startZ + z*sampleStepZ) * frequency;
+        uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+        for(uint32 y = tileY; y < tileY + tileHeight; y++)
+        {
+          WN_DECIMAL yCoord = (startY + y*sampleStepY) * frequency;
+          WN_DECIMAL *row = values + zOffset + LayoutOffset(1, y, width, height, depth);
+          for(uint32 x = 0; x < tileWidth; x++)
+          {
+            row[xOffsets[x]] = Remap(invoke(func, *this, xCoords[x], yCoord, zCoord));
+          }
+        }
       }
     }
   }
   return values;
 }
 
+// 3D Cube (Masked)
+template<class NoiseFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetMaskedCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  FillUnmasked(values, width, height, depth);
+
+  uint32 indices[MaskChunkLength];
+  WN_DECIMAL xCoords[MaskChunkLength];
+  WN_DECIMAL yCoords[MaskChunkLength];
+  WN_DECIMAL zCoords[MaskChunkLength];
+  uint32 offsets[MaskChunkLength];
+  uint32 next = 0;
+  while(next < width * height * depth)
+  {
+    uint32 count = CompactMask(next, width * height * depth, indices);
+    for(uint32 i = 0; i < count; i++)
+    {
+      uint32 x = indices[i] % width;
+      uint32 y = (indices[i] / width) % height;
+      uint32 z = indices[i] / (width * height);
+      xCoords[i] = (startX + x*sampleStepX) * frequency;
+      yCoords[i] = (startY + y*sampleStepY) * frequency;
+      zCoords[i] = (startZ + z*sampleStepZ) * frequency;
+      offsets[i] = LayoutOffset(2, z, width, height, depth) + LayoutOffset(1, y, width, height, depth) + LayoutOffset(0, x, width, height, depth);
+    }
+    for(uint32 i = 0; i < count; i++)
+    {
+      values[offsets[i]] = Remap(invoke(func, *this, xCoords[i], yCoords[i], zCoords[i]));
+    }
+  }
+  return values;
+}
+
 // 4D Cube
 template<class NoiseFunc> 
 WN_INLINE WN_DECIMAL *WasmNoise::GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW)
 {
-  WN_DECIMAL *values = returnHelper.NewArray(width*height*depth);
+  if(!IsValidLayout(width, height, depth))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  WN_DECIMAL xCoords[CubeTileSize];
+  uint32 xOffsets[CubeTileSize];
+  WN_DECIMAL wCoord = startW * frequency;
+  for(uint32 tileY = 0; tileY < height; tileY += CubeTileSize)
+  {
+    uint32 tileHeight = min(height - tileY, CubeTileSize);
+    for(uint32 tileX = 0; tileX < width; tileX += CubeTileSize)
+    {
+      uint32 tileWidth = min(width - tileX, CubeTileSize);
+      for(uint32 x = 0; x < tileWidth; x++)
+      {
+        xCoords[x] = (startX + (tileX+x)*sampleStepX) * frequency;
+        xOffsets[x] = LayoutOffset(0, tileX+x, width, height, depth);
+      }
+
+      for(uint32 z = 0; z < depth; z++)
+      {
+        WN_DECIMAL zCoord = (startZ + z*sampleStepZ) * frequency;
+        uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+        for(uint32 y = tileY; y < tileY + tileHeight; y++)
+        {
+          WN_DECIMAL yCoord = (startY + y*sampleStepY) * frequency;
+          WN_DECIMAL *row = values + zOffset + LayoutOffset(1, y, width, height, depth);
+          for(uint32 x = 0; x < tileWidth; x++)
+          {
+            row[xOffsets[x]] = Remap(invoke(func, *this, xCoords[x], yCoord, zCoord, wCoord));
+          }
+        }
+      }
+    }
+  }
+  return values;
+}
+
+#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL)
+// 2D Square Pyramid
+// Level n covers the same area as level 0 but only samples every 2^n-th sample, using n fewer octaves.
+// Since a level n sample sits at exactly the same coordinate as a level 0 sample, its value is just
+// the running fractal sum of that level 0 sample after fewer octaves, so the coarse levels cost no 
+// extra noise evaluations. Levels are packed one after another, level n being 
+// ceil(width / 2^n) * ceil(height / 2^n) values, always into a new array so the output target and 
+// row stride don't apply
+template<class OctavesFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetSquarePyramid(OctavesFunc func, uint32 width, uint32 height, uint32 levels, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  constexpr uint32 MaxLevels = 32;
+  uint32 octaves = max(fractalOctaves, 1u);
+
+  // Stop once both dimensions have been reduced to a single sample
+  uint32 maxLevels = 1;
+  while(maxLevels < MaxLevels && ((width - 1) >> maxLevels || (height - 1) >> maxLevels)) maxLevels++;
+  levels = max(min(levels, maxLevels), 1u);
+
+  uint32 levelWidth[MaxLevels];
+  uint32 levelOffset[MaxLevels];
+  uint32 levelOctave[MaxLevels];
+  WN_DECIMAL levelScale[MaxLevels];
+  WN_DECIMAL levelBias[MaxLevels];
+  uint32 total = 0;
+  for(uint32 l = 0; l < levels; l++)
+  {
+    uint32 levelHeight = (height + (1u << l) - 1) >> l;
+    levelWidth[l] = (width + (1u << l) - 1) >> l;
+    levelOffset[l] = total;
+    total += levelWidth[l] * levelHeight;
+
+    // Each halving of resolution drops the finest octave, the fewer octaves are rescaled like a 
+    // fractal which only ever had that many octaves
+    levelOctave[l] = (octaves > l) ? octaves - 1 - l : 0;
+    if(fractalType == FractalType::RidgedMulti)
+    {
+      levelScale[l] = WN_DECIMAL(1.25);
+      levelBias[l] = WN_DECIMAL(-1.0);
+    }
+    else
+    {
+      WN_DECIMAL amp = 1;
+      WN_DECIMAL ampFractal = 0;
+      for(uint32 i = 0; i <= levelOctave[l]; i++)
+      {
+        ampFractal += amp;
+        amp *= fractalGain;
+      }
+      levelScale[l] = WN_DECIMAL(1.0) / ampFractal;
+      levelBias[l] = 0;
+    }
+  }
+
+  WN_DECIMAL *values = returnHelper.NewArray(total);
+  WN_DECIMAL *octaveSums = octaveHelper.NewArray(octaves);
+  for(uint32 y = 0; y < height; y++)
+  {
+    for(uint32 x = 0; x < width; x++)
+    {
+      invoke(func, *this, octaveSums, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency);
+      values[(width*y) + x] = Remap(octaveSums[levelOctave[0]] * levelScale[0] + levelBias[0]);
+
+      // A sample is shared by every level whose spacing divides its position
+      for(uint32 l = 1; l < levels && ((x | y) & ((1u << l) - 1)) == 0; l++)
+      {
+        values[levelOffset[l] + (levelWidth[l] * (y >> l)) + (x >> l)] = Remap(octaveSums[levelOctave[l]] * levelScale[l] + levelBias[l]);
+      }
+    }
+  }
+  return values;
+}
+#endif // WN_INCLUDE_PERLIN_FRACTAL || WN_INCLUDE_SIMPLEX_FRACTAL
+
+#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL) || defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+// Threshold masks pack one bit per sample, sample i (x fastest, then y, then z) being bit i % 32 of 
+// word i / 32. They're always dense, the output layout, target and remap curve don't apply
+
+// 2D Square Mask
+template<class NoiseFunc>
+WN_INLINE uint32 *WasmNoise::GetSquareMask(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  uint32 words = (width * height + 31) / 32;
+  uint32 *mask = maskHelper.NewArray(words);
+  for(uint32 i = 0; i < words; i++)
+  {
+    mask[i] = 0;
+  }
+
+  uint32 i = 0;
+  for(uint32 y = 0; y < height; y++)
+  {
+    for(uint32 x = 0; x < width; x++, i++)
+    {
+      if(SingleFractalAbove(func, threshold, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency))
+      {
+        mask[i >> 5] |= 1u << (i & 31);
+      }
+    }
+  }
+  return mask;
+}
+
+// 3D Cube Mask
+template<class NoiseFunc>
+WN_INLINE uint32 *WasmNoise::GetCubeMask(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  uint32 words = (width * height * depth + 31) / 32;
+  uint32 *mask = maskHelper.NewArray(words);
+  for(uint32 i = 0; i < words; i++)
+  {
+    mask[i] = 0;
+  }
+
+  uint32 i = 0;
   for(uint32 z = 0; z < depth; z++)
   {
     for(uint32 y = 0; y < height; y++)
     {
-      for(uint32 x = 0; x < height; x++)
+      for(uint32 x = 0; x < width; x++, i++)
       {
-        values[(height * width * z) + (width * y) + x] = invoke(func, *this, (startX+x) * frequency, (startY+y) * frequency, (startZ+z) * frequency, startW * frequency);
+        if(SingleFractalAbove(func, threshold, (startX + x*sampleStepX) * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency))
+        {
+          mask[i >> 5] |= 1u << (i & 31);
+        }
+      }
+    }
+  }
+  return mask;
+}
+#endif // WN_INCLUDE_PERLIN_FRACTAL || WN_INCLUDE_SIMPLEX_FRACTAL || WN_INCLUDE_VALUE_FRACTAL || WN_INCLUDE_CUBIC_FRACTAL
+
+#if defined(WN_INCLUDE_VALUE) || defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+// Row-major output is written by the row kernel in place, other layouts and remapped output go 
+// through a chunk buffer and are scattered to their layout offsets
+
+// 2D Square (Rows)
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  if(!IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  if(sampleMask != nullptr)
+  {
+    return GetMaskedSquareRows(func, width, height, startX, startY);
+  }
+  if(adaptiveTolerance > 0)
+  {
+    return GetAdaptiveSquare(RowSample<RowFunc>{ func }, width, height, startX, startY);
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  WN_DECIMAL chunk[RowChunkLength];
+  bool inPlace = outputLayout == OutputLayout::RowMajor && remapLUT == nullptr;
+  for(uint32 y = 0; y < height; y++)
+  {
+    uint32 rowOffset = LayoutOffset(1, y, width, height, 1);
+    for(uint32 x = 0; x < width; x += RowChunkLength)
+    {
+      uint32 length = min(width - x, RowChunkLength);
+      invoke(func, *this, inPlace ? values + rowOffset + x : chunk, length, (startX + x*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency);
+      for(uint32 i = 0; !inPlace && i < length; i++)
+      {
+        values[rowOffset + LayoutOffset(0, x+i, width, height, 1)] = Remap(chunk[i]);
+      }
+    }
+  }
+  return values;
+}
+
+// 3D Square (Rows), XY plane only
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  if(!IsValidLayout(width, height, 1))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  WN_DECIMAL chunk[RowChunkLength];
+  bool inPlace = outputLayout == OutputLayout::RowMajor && remapLUT == nullptr;
+  for(uint32 y = 0; y < height; y++)
+  {
+    uint32 rowOffset = LayoutOffset(1, y, width, height, 1);
+    for(uint32 x = 0; x < width; x += RowChunkLength)
+    {
+      uint32 length = min(width - x, RowChunkLength);
+      invoke(func, *this, inPlace ? values + rowOffset + x : chunk, length, (startX + x*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency, startZ * frequency);
+      for(uint32 i = 0; !inPlace && i < length; i++)
+      {
+        values[rowOffset + LayoutOffset(0, x+i, width, height, 1)] = Remap(chunk[i]);
+      }
+    }
+  }
+  return values;
+}
+
+// 3D Cube (Rows)
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetCubeRows(RowFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  if(!IsValidLayout(width, height, depth))
+  {
+    ABORT();
+    return nullptr;
+  }
+
+  if(sampleMask != nullptr)
+  {
+    return GetMaskedCubeRows(func, width, height, depth, startX, startY, startZ);
+  }
+  if(IsCubeSubsampled())
+  {
+    uint32 coarseWidth = CoarseCount(width, cubeSubsampleX);
+    uint32 coarseHeight = CoarseCount(height, cubeSubsampleY);
+    uint32 coarseDepth = CoarseCount(depth, cubeSubsampleZ);
+    WN_DECIMAL *coarse = coarseHelper.NewArray(coarseWidth * coarseHeight * coarseDepth);
+    WN_DECIMAL *row = coarse;
+    for(uint32 z = 0; z < coarseDepth; z++)
+    {
+      for(uint32 y = 0; y < coarseHeight; y++, row += coarseWidth)
+      {
+        for(uint32 x = 0; x < coarseWidth; x += RowChunkLength)
+        {
+          invoke(func, *this, row + x, min(coarseWidth - x, RowChunkLength), (startX + x*cubeSubsampleX*sampleStepX) * frequency, cubeSubsampleX * sampleStepX * frequency, (startY + y*cubeSubsampleY*sampleStepY) * frequency, (startZ + z*cubeSubsampleZ*sampleStepZ) * frequency);
+        }
+      }
+    }
+    return UpsampleCube(coarse, width, height, depth);
+  }
+
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  WN_DECIMAL chunk[RowChunkLength];
+  bool inPlace = outputLayout == OutputLayout::RowMajor && remapLUT == nullptr;
+  for(uint32 z = 0; z < depth; z++)
+  {
+    uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+    for(uint32 y = 0; y < height; y++)
+    {
+      uint32 rowOffset = zOffset + LayoutOffset(1, y, width, height, depth);
+      for(uint32 x = 0; x < width; x += RowChunkLength)
+      {
+        uint32 length = min(width - x, RowChunkLength);
+        invoke(func, *this, inPlace ? values + rowOffset + x : chunk, length, (startX + x*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency);
+        for(uint32 i = 0; !inPlace && i < length; i++)
+        {
+          values[rowOffset + LayoutOffset(0, x+i, width, height, depth)] = Remap(chunk[i]);
+        }
       }
     }
   }
   return values;
 }
+
+// 2D Square (Masked Rows)
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetMaskedSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY)
+{
+  WN_DECIMAL *values = NewOutput(width, height, 1);
+  FillUnmasked(values, width, height, 1);
+
+  WN_DECIMAL chunk[RowChunkLength];
+  for(uint32 y = 0; y < height; y++)
+  {
+    uint32 rowOffset = LayoutOffset(1, y, width, height, 1);
+    uint32 rowStart = y * width;
+    for(uint32 x = 0; x < width; )
+    {
+      if(!IsMasked(rowStart + x))
+      {
+        x++;
+        continue;
+      }
+
+      uint32 length = 1;
+      while(x + length < width && length < RowChunkLength && IsMasked(rowStart + x + length))
+      {
+        length++;
+      }
+      invoke(func, *this, chunk, length, (startX + x*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency);
+      for(uint32 i = 0; i < length; i++)
+      {
+        values[rowOffset + LayoutOffset(0, x+i, width, height, 1)] = Remap(chunk[i]);
+      }
+      x += length;
+    }
+  }
+  return values;
+}
+
+// 3D Cube (Masked Rows)
+template<class RowFunc>
+WN_INLINE WN_DECIMAL *WasmNoise::GetMaskedCubeRows(RowFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ)
+{
+  WN_DECIMAL *values = NewOutput(width, height, depth);
+  FillUnmasked(values, width, height, depth);
+
+  WN_DECIMAL chunk[RowChunkLength];
+  for(uint32 z = 0; z < depth; z++)
+  {
+    uint32 zOffset = LayoutOffset(2, z, width, height, depth);
+    for(uint32 y = 0; y < height; y++)
+    {
+      uint32 rowOffset = zOffset + LayoutOffset(1, y, width, height, depth);
+      uint32 rowStart = (z * height + y) * width;
+      for(uint32 x = 0; x < width; )
+      {
+        if(!IsMasked(rowStart + x))
+        {
+          x++;
+          continue;
+        }
+
+        uint32 length = 1;
+        while(x + length < width && length < RowChunkLength && IsMasked(rowStart + x + length))
+        {
+          length++;
+        }
+        invoke(func, *this, chunk, length, (startX + x*sampleStepX) * frequency, sampleStepX * frequency, (startY + y*sampleStepY) * frequency, (startZ + z*sampleStepZ) * frequency);
+        for(uint32 i = 0; i < length; i++)
+        {
+          values[rowOffset + LayoutOffset(0, x+i, width, height, depth)] = Remap(chunk[i]);
+        }
+        x += length;
+      }
+    }
+  }
+  return values;
+}
+#endif // WN_INCLUDE_VALUE || WN_INCLUDE_VALUE_FRACTAL || WN_INCLUDE_CUBIC || WN_INCLUDE_CUBIC_FRACTAL
+
+#if defined(WN_INCLUDE_VIEWPORT) || defined(WN_INCLUDE_GRAPH) || defined(WN_INCLUDE_MESH)
+// Noise Function Lookup
+// Every set has a 2D and a 3D overload of each function, the return type picks between them
+template<class FuncPtr> FuncPtr WasmNoise::GetNoiseFunc(NoiseType noiseType) const
+{
+  switch(noiseType)
+  {
+#ifdef WN_INCLUDE_PERLIN
+  case NoiseType::Perlin:  return &WasmNoise::SinglePerlinNoOffset;
+#endif
+#ifdef WN_INCLUDE_PERLIN_FRACTAL
+  case NoiseType::PerlinFractal:
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return &WasmNoise::SinglePerlinFractalFBM;
+    case FractalType::Billow:       return &WasmNoise::SinglePerlinFractalBillow;
+    case FractalType::RidgedMulti:  return &WasmNoise::SinglePerlinFractalRidgedMulti;
+    default: return nullptr;
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_SIMPLEX
+  case NoiseType::Simplex: return &WasmNoise::SingleSimplexNoOffset;
+#endif
+#ifdef WN_INCLUDE_SIMPLEX_FRACTAL
+  case NoiseType::SimplexFractal:
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return &WasmNoise::SingleSimplexFractalFBM;
+    case FractalType::Billow:       return &WasmNoise::SingleSimplexFractalBillow;
+    case FractalType::RidgedMulti:  return &WasmNoise::SingleSimplexFractalRidgedMulti;
+    default: return nullptr;
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_CELLULAR
+  case NoiseType::Cellular:
+  {
+    switch(cellularReturnType)
+    {
+    case CellularReturnType::CellValue:
+    case CellularReturnType::Distance:
+    case CellularReturnType::NoiseLookupPerlin:
+    case CellularReturnType::NoiseLookupSimplex:
+      return &WasmNoise::SingleCellularNoOffset;
+    default: // Distance2
+      return &WasmNoise::SingleCellular2EdgeNoOffset;
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_CELLULAR_FRACTAL
+  case NoiseType::CellularFractal:
+  {
+    switch(cellularReturnType)
+    {
+    case CellularReturnType::CellValue:
+    case CellularReturnType::Distance:
+    case CellularReturnType::NoiseLookupPerlin:
+    case CellularReturnType::NoiseLookupSimplex:
+    {
+      switch(fractalType)
+      {
+      case FractalType::FBM:          return &WasmNoise::SingleCellularFractalFBM;
+      case FractalType::Billow:       return &WasmNoise::SingleCellularFractalBillow;
+      case FractalType::RidgedMulti:  return &WasmNoise::SingleCellularFractalRidgedMulti;
+      default: return nullptr;
+      }
+    }
+    default: // Distance2
+    {
+      switch(fractalType)
+      {
+      case FractalType::FBM:          return &WasmNoise::SingleCellular2EdgeFractalFBM;
+      case FractalType::Billow:       return &WasmNoise::SingleCellular2EdgeFractalBillow;
+      case FractalType::RidgedMulti:  return &WasmNoise::SingleCellular2EdgeFractalRidgedMulti;
+      default: return nullptr;
+      }
+    }
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_VALUE
+  case NoiseType::Value:   return &WasmNoise::SingleValueNoOffset;
+#endif
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+  case NoiseType::ValueFractal:
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return &WasmNoise::SingleValueFractalFBM;
+    case FractalType::Billow:       return &WasmNoise::SingleValueFractalBillow;
+    case FractalType::RidgedMulti:  return &WasmNoise::SingleValueFractalRidgedMulti;
+    default: return nullptr;
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_CUBIC
+  case NoiseType::Cubic:   return &WasmNoise::SingleCubicNoOffset;
+#endif
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+  case NoiseType::CubicFractal:
+  {
+    switch(fractalType)
+    {
+    case FractalType::FBM:          return &WasmNoise::SingleCubicFractalFBM;
+    case FractalType::Billow:       return &WasmNoise::SingleCubicFractalBillow;
+    case FractalType::RidgedMulti:  return &WasmNoise::SingleCubicFractalRidgedMulti;
+    default: return nullptr;
+    }
+  }
+#endif
+#ifdef WN_INCLUDE_WHITE
+  case NoiseType::White:   return &WasmNoise::SingleWhite;
+#endif
+  default: // Noise set not included in this build
+    return nullptr;
+  }
+}
+#endif // WN_INCLUDE_VIEWPORT || WN_INCLUDE_GRAPH || WN_INCLUDE_MESH
+
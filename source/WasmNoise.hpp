@@ -7,13 +7,20 @@
 class WasmNoise
 {
 public:
-  // This isn't actually used anywhere yet, until we implement a generic GetNoise function
+  // Selects the noise set used by the generic generators (e.g. the viewport)
   enum class NoiseType
   {
     Perlin = 0,
     PerlinFractal = 1,
     Simplex = 2,
-    Cellular = 3
+    Cellular = 3,
+    SimplexFractal = 4,
+    CellularFractal = 5,
+    Value = 6,
+    ValueFractal = 7,
+    Cubic = 8,
+    CubicFractal = 9,
+    White = 10
   };
   enum class Interp
   {
@@ -62,6 +69,16 @@ public:
     YWPlane = 4,
     ZWPlane = 5,
   };
+  // Order in which squares and cubes are written to their returned array, strips are always linear
+  enum class OutputLayout
+  {
+    RowMajor = 0, // x fastest, then y, then z
+    Morton = 1,   // Z-order, every dimension must be a power of two
+    YZX = 2,      // y fastest, then z, then x
+    Brick = 3     // BrickSize^3 row-major bricks (BrickSize^2 for squares) stored in row-major order, 
+                  // every dimension must be a multiple of BrickSize
+  };
+  static constexpr uint32 BrickSize = 8;
 
   explicit WasmNoise( int32 _seed = 42
                     , WN_DECIMAL _frequency = 0.01
@@ -89,10 +106,69 @@ public:
     , cellularDistanceIndex1(_cellularDistanceIndex1)
     , cellularJitter(_cellularJitter)
     , cellularNoiseLookupFrequency(_cellularNoiseLookupFrequency)
+    , sampleStepX(1)
+    , sampleStepY(1)
+    , sampleStepZ(1)
+    , sampleStepW(1)
+    , outputLayout(OutputLayout::RowMajor)
+    , outputRowStride(0)
+    , outputTarget(nullptr)
+    , outputTargetPitch(0)
+    , outputTargetRows(0)
+    , outputTargetX(0)
+    , outputTargetY(0)
+    , sampleMask(nullptr)
+    , sampleMaskFill(0)
+    , periodX(0)
+    , periodY(0)
+    , periodZ(0)
+    , latticeOriginX(0)
+    , latticeOriginY(0)
+    , latticeOriginZ(0)
+    , cubeSubsampleX(1)
+    , cubeSubsampleY(1)
+    , cubeSubsampleZ(1)
+    , adaptiveTolerance(0)
+    , adaptiveSampleCount(0)
+    , latticeOctaves(nullptr)
+    , lattice(nullptr)
+    , latticeShifted(false)
+    , remapLUT(nullptr)
+    , remapLUTCount(0)
+    , remapLUTScale(0)
+#ifdef WN_INCLUDE_VIEWPORT
+    , viewportFunc(nullptr)
+    , viewportValues(nullptr)
+    , viewportWidth(0)
+    , viewportHeight(0)
+    , viewportX(0)
+    , viewportY(0)
+#endif
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+    , sparseBrickMap(nullptr)
+    , sparseBrickCount(0)
+#endif
+#ifdef WN_INCLUDE_GRAPH
+    , graphNodes(nullptr)
+    , graphNodeCount(0)
+    , graphScratch(nullptr)
+#endif
+#ifdef WN_INCLUDE_MESH
+    , meshVertices(nullptr)
+    , meshVertexCount(0)
+    , meshVertexCapacity(0)
+    , meshIndices(nullptr)
+    , meshIndexCount(0)
+    , meshIndexCapacity(0)
+#endif
   { 
     SetSeed(_seed);
     CalculateFractalBounding();
     CalculateFractalExponents();
+    CalculateLatticeOctaves();
+#ifdef WN_INCLUDE_MESH
+    BuildMeshTables();
+#endif
   }
 
   void SetSeed(int32 _seed);
@@ -104,11 +180,88 @@ public:
   void SetInterp(Interp _interp) { interp = _interp; }
   Interp GetInterp() const { return interp; }
 
+  // Spacing between neighbouring samples of strips, squares and cubes along each axis, in units of 
+  // the start coordinates (before frequency is applied)
+  // Default: 1, 1, 1, 1
+  void SetSampleStep(WN_DECIMAL _sampleStepX, WN_DECIMAL _sampleStepY, WN_DECIMAL _sampleStepZ, WN_DECIMAL _sampleStepW);
+  WN_DECIMAL GetSampleStepX() const { return sampleStepX; }
+  WN_DECIMAL GetSampleStepY() const { return sampleStepY; }
+  WN_DECIMAL GetSampleStepZ() const { return sampleStepZ; }
+  WN_DECIMAL GetSampleStepW() const { return sampleStepW; }
+
+  // Squares and cubes with dimensions the layout doesn't support return nullptr
+  void SetOutputLayout(OutputLayout _outputLayout) { outputLayout = _outputLayout; }
+  OutputLayout GetOutputLayout() const { return outputLayout; }
+
+  // Distance in values between the starts of consecutive rows of row-major squares and cubes, slices
+  // are rowStride * height apart. Strides smaller than the width (e.g. the default 0) use the width
+  void SetOutputRowStride(uint32 _outputRowStride) { outputRowStride = _outputRowStride; }
+  uint32 GetOutputRowStride() const { return outputRowStride; }
+
+  // Writes squares and cubes straight into a sub-rectangle of dest (e.g. a texture atlas), starting 
+  // at (offsetX, offsetY) with rows pitch values apart and slices pitch * height apart, instead of 
+  // into a new array. The bulk functions then return a pointer to the first value written
+  // dest holds rows rows of pitch values. Only the row-major layout is supported, squares and cubes 
+  // which would run past the right or bottom edge of dest from the offset return nullptr
+  void SetOutputTarget(WN_DECIMAL *dest, uint32 pitch, uint32 rows, uint32 offsetX, uint32 offsetY);
+  void ClearOutputTarget() { outputTarget = nullptr; }
+
+  // Only evaluates the samples of 2D squares and 3D cubes whose bit is set in mask, the others are 
+  // set to fill. Sample i (x fastest, then y, then z) is bit i % 32 of word i / 32, the layout of 
+  // the threshold masks. The mask isn't copied and must cover every sample of the squares and cubes 
+  // generated while it's set. Adaptive sampling and cube subsampling don't apply to masked output
+  void SetSampleMask(const uint32 *mask, WN_DECIMAL fill);
+  void ClearSampleMask() { sampleMask = nullptr; }
+
+  // Makes Perlin, Value, Cubic and Cellular noise repeat every period lattice cells along X, Y and Z
+  // (e.g. a width * frequency period makes a width wide square tile seamlessly), 0 disables wrapping
+  // Fractals scale the period with each octave and stay seamless as long as the lacunarity is a 
+  // whole number. Simplex noise doesn't tile
+  // Default: 0, 0, 0
+  void SetPeriod(int32 _periodX, int32 _periodY, int32 _periodZ);
+  int32 GetPeriodX() const { return periodX; }
+  int32 GetPeriodY() const { return periodY; }
+  int32 GetPeriodZ() const { return periodZ; }
+
+  // Samples relative to the corner of an integer chunk, chunkCells being the chunk size in lattice
+  // cells (chunk size * frequency, which must be a whole number). Start coordinates passed to the 
+  // noise functions are then offsets within the chunk, so they stay small and precise however far 
+  // the chunk is from the origin, and the chunk corner is added to the lattice coordinates as an 
+  // integer. Applies to Perlin, Value, Cubic and Cellular noise, Simplex noise aborts. Fractals need 
+  // a whole number lacunarity, otherwise this (and any lacunarity set later) aborts
+  void SetChunkOrigin(int32 chunkX, int32 chunkY, int32 chunkZ, int32 chunkCells);
+  void ClearChunkOrigin();
+
+  // Evaluates 3D cubes only every subsample samples along each axis and fills the samples in between
+  // by trilinear interpolation, cutting the noise evaluations of smooth fields such as terrain density
+  // by the product of the factors. 1, 1, 1 evaluates every sample
+  // Default: 1, 1, 1
+  void SetCubeSubsample(uint32 _subsampleX, uint32 _subsampleY, uint32 _subsampleZ);
+  uint32 GetCubeSubsampleX() const { return cubeSubsampleX; }
+  uint32 GetCubeSubsampleY() const { return cubeSubsampleY; }
+  uint32 GetCubeSubsampleZ() const { return cubeSubsampleZ; }
+
+  // Samples 2D squares adaptively. Blocks of AdaptiveBlockSize samples are split like a quadtree 
+  // until interpolating their corners predicts the noise at the block's centre and edge midpoints 
+  // to within tolerance, the samples of such blocks are filled in by bilinear interpolation 
+  // 0 evaluates every sample
+  // Default: 0
+  void SetAdaptiveTolerance(WN_DECIMAL _adaptiveTolerance);
+  WN_DECIMAL GetAdaptiveTolerance() const { return adaptiveTolerance; }
+  // Number of samples the last adaptive square actually evaluated
+  uint32 GetAdaptiveSampleCount() const { return adaptiveSampleCount; }
+
+  // Remaps every value written by the bulk functions through a piecewise-linear curve, the count 
+  // points of lut are spread evenly over [-1, 1]. The points are copied, power or terrace curves 
+  // can be baked into a LUT of the desired resolution. Fewer than 2 points clears the remap
+  void SetRemapLUT(const WN_DECIMAL *lut, uint32 count);
+  void ClearRemap();
+
 #ifdef WN_INCLUDE_FRACTAL_GETSET
-  void SetFractalOctaves(uint32 _octaves) { fractalOctaves = _octaves; CalculateFractalBounding(); CalculateFractalExponents(); }
+  void SetFractalOctaves(uint32 _octaves) { fractalOctaves = _octaves; CalculateFractalBounding(); CalculateFractalExponents(); CalculateLatticeOctaves(); }
   uint32 GetFractalOctaves() const { return fractalOctaves; }
 
-  void SetFractalLacunarity(WN_DECIMAL _lacunarity) { fractalLacunarity = _lacunarity; CalculateFractalExponents();}
+  void SetFractalLacunarity(WN_DECIMAL _lacunarity) { fractalLacunarity = _lacunarity; CalculateFractalExponents(); CalculateLatticeOctaves(); }
   WN_DECIMAL GetFractalLacunarity() const { return fractalLacunarity; }
 
   void SetFractalGain(WN_DECIMAL _gain) { fractalGain = _gain; CalculateFractalBounding(); }
@@ -160,12 +313,16 @@ public:
   WN_INLINE WN_DECIMAL  GetPerlinFractal(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL *GetPerlinFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
   WN_INLINE WN_DECIMAL *GetPerlinFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);  
+  WN_INLINE WN_DECIMAL *GetPerlinFractalSquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels);
 
   // 3D
   WN_INLINE WN_DECIMAL  GetPerlinFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
   WN_INLINE WN_DECIMAL *GetPerlinFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
   WN_INLINE WN_DECIMAL *GetPerlinFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
   WN_INLINE WN_DECIMAL *GetPerlinFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+  // Threshold masks, one bit per sample which is set when the fractal is above threshold
+  WN_INLINE uint32 *GetPerlinFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold);
+  WN_INLINE uint32 *GetPerlinFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold);
 #endif // WN_INCLUDE_PERLIN_FRACTAL
 
 #ifdef WN_INCLUDE_SIMPLEX
@@ -192,6 +349,7 @@ public:
   WN_INLINE WN_DECIMAL  GetSimplexFractal(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL *GetSimplexFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
   WN_INLINE WN_DECIMAL *GetSimplexFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+  WN_INLINE WN_DECIMAL *GetSimplexFractalSquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels);
 
   // 3D
   WN_INLINE WN_DECIMAL  GetSimplexFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
@@ -204,6 +362,9 @@ public:
   WN_INLINE WN_DECIMAL *GetSimplexFractalStrip(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w, uint32 length, StripDirection direction);
   WN_INLINE WN_DECIMAL *GetSimplexFractalSquare(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w, uint32 width, uint32 height, SquarePlane plane);
   WN_INLINE WN_DECIMAL *GetSimplexFractalCube(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w, uint32 width, uint32 height, uint32 depth);
+  // Threshold masks, one bit per sample which is set when the fractal is above threshold
+  WN_INLINE uint32 *GetSimplexFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold);
+  WN_INLINE uint32 *GetSimplexFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold);
 #endif // WN_INCLUDE_SIMPLEX_FRACTAL
 
 #ifdef WN_INCLUDE_CELLULAR
@@ -211,6 +372,16 @@ public:
   WN_INLINE WN_DECIMAL  GetCellular(WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL *GetCellularStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
   WN_INLINE WN_DECIMAL *GetCellularSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+  // Several cellular outputs from a single neighbour search, outputs being a combination of the 
+  // CellularOutput flags. Each selected output gets a width*height row-major plane, the planes 
+  // following each other in the order of the flags (the offset taking two planes, x then y)
+  static constexpr uint32 CellularOutputF1 = 1;         // Same as the Distance return type
+  static constexpr uint32 CellularOutputF2 = 2;         // Same as the Distance2 return type
+  static constexpr uint32 CellularOutputF2SubF1 = 4;    // Same as the Distance2Sub return type
+  static constexpr uint32 CellularOutputCellValue = 8;  // Same as the CellValue return type
+  static constexpr uint32 CellularOutputCellID = 16;    // 24 bit hash of the nearest cell, stored as a whole number
+  static constexpr uint32 CellularOutputOffset = 32;    // Nearest point relative to the sample, in lattice units
+  WN_INLINE WN_DECIMAL *GetCellularSquareOutputs(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 outputs);
 
   // 3D
   WN_INLINE WN_DECIMAL  GetCellular(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
@@ -232,8 +403,195 @@ public:
   WN_INLINE WN_DECIMAL *GetCellularFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
 #endif // WN_INCLUDE_CELLULAR_FRACTAL
 
+#ifdef WN_INCLUDE_VALUE
+  // 2D
+  WN_INLINE WN_DECIMAL  GetValue(WN_DECIMAL x, WN_DECIMAL y) const;
+  WN_INLINE WN_DECIMAL *GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetValue(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE WN_DECIMAL *GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetValueCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+
+  // 4D
+  WN_INLINE WN_DECIMAL  GetValue(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const;
+  WN_INLINE WN_DECIMAL *GetValueStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetValueCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth);
+#endif // WN_INCLUDE_VALUE
+
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+  // 2D
+  WN_INLINE WN_DECIMAL  GetValueFractal(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL *GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetValueFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL *GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetValueFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+
+  // 4D
+  WN_INLINE WN_DECIMAL  GetValueFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+  WN_INLINE WN_DECIMAL *GetValueFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetValueFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetValueFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth);
+  // Threshold masks, one bit per sample which is set when the fractal is above threshold
+  WN_INLINE uint32 *GetValueFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold);
+  WN_INLINE uint32 *GetValueFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold);
+  // Sparse cube, width, height and depth must be multiples of BrickSize. Bricks that can't cross the 
+  // threshold are only flagged in the brick map, the returned values hold the remaining bricks
+  WN_INLINE WN_DECIMAL *GetValueFractalSparseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold);
+  // One entry per brick (x fastest) of the last sparse cube, SparseBrickBelow, SparseBrickAbove or 
+  // SparseBrickDense + the index of the brick in the returned values
+  static constexpr uint32 SparseBrickBelow = 0;
+  static constexpr uint32 SparseBrickAbove = 1;
+  static constexpr uint32 SparseBrickDense = 2;
+  uint32 *GetSparseBrickMap() const { return sparseBrickMap; }
+  uint32 GetSparseBrickCount() const { return sparseBrickCount; }
+#endif // WN_INCLUDE_VALUE_FRACTAL
+
+#ifdef WN_INCLUDE_CUBIC
+  // 2D
+  WN_INLINE WN_DECIMAL  GetCubic(WN_DECIMAL x, WN_DECIMAL y) const;
+  WN_INLINE WN_DECIMAL *GetCubicStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetCubicSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetCubic(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE WN_DECIMAL *GetCubicStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetCubicSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetCubicCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+#endif // WN_INCLUDE_CUBIC
+
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+  // 2D
+  WN_INLINE WN_DECIMAL  GetCubicFractal(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL *GetCubicFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetCubicFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetCubicFractal(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL *GetCubicFractalStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetCubicFractalSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetCubicFractalCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+  // Threshold masks, one bit per sample which is set when the fractal is above threshold
+  WN_INLINE uint32 *GetCubicFractalSquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold);
+  WN_INLINE uint32 *GetCubicFractalCubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold);
+#endif // WN_INCLUDE_CUBIC_FRACTAL
+
+#ifdef WN_INCLUDE_WHITE
+  // Float coordinates are hashed by their bit pattern, so only exactly equal coordinates share a value
+  // 2D
+  WN_INLINE WN_DECIMAL  GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth);
+
+  // 4D
+  WN_INLINE WN_DECIMAL  GetWhiteNoise(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseStrip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseSquare(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth);
+
+  // Reads count points of interleaved coordinates (x0, y0[, z0[, w0]], x1, ...), dimensions is 2, 3 or 4
+  WN_INLINE WN_DECIMAL *GetWhiteNoisePoints(const WN_DECIMAL *coords, uint32 count, uint32 dimensions);
+
+  // Integer coordinates, frequency is not applied
+  // 2D
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt(int32 x, int32 y) const;
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntStrip(int32 startX, int32 startY, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntSquare(int32 startX, int32 startY, uint32 width, uint32 height);
+
+  // 3D
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt(int32 x, int32 y, int32 z) const;
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntStrip(int32 startX, int32 startY, int32 startZ, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntSquare(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntCube(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, uint32 depth);
+
+  // 4D
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt(int32 x, int32 y, int32 z, int32 w) const;
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntStrip(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 length, StripDirection direction);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntSquare(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, SquarePlane plane);
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntCube(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, uint32 depth);
+
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseIntPoints(const int32 *coords, uint32 count, uint32 dimensions);
+#endif // WN_INCLUDE_WHITE
+
+#ifdef WN_INCLUDE_VIEWPORT
+  // A width*height square kept in a ring buffer, panning only generates the newly exposed
+  // rows and columns. Sample (x, y) of the view is found at 
+  // values[((ringY + y) % height) * width + ((ringX + x) % width)]
+  // Call SetViewport again after changing any noise settings
+  WN_DECIMAL *SetViewport(NoiseType noiseType, WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+  // Moves the view by whole samples, returns the ring offset (ringY * width + ringX)
+  uint32 PanViewport(int32 dx, int32 dy);
+  uint32 GetViewportRingOffset() const;
+  WN_DECIMAL *GetViewportValues() const { return viewportValues; }
+#endif // WN_INCLUDE_VIEWPORT
+
+#ifdef WN_INCLUDE_GRAPH
+  // Operators of a noise graph node
+  enum class GraphOp
+  {
+    Source = 0,
+    Constant = 1,
+    Add = 2,
+    Multiply = 3,
+    Min = 4,
+    Max = 5,
+    Clamp = 6,
+    Select = 7
+  };
+  static constexpr uint32 GraphRecordLength = 4;
+
+  // Compiles a 2D noise graph from nodeCount records of GraphRecordLength decimals, { op, arg0, arg1, arg2 }:
+  //   Source   { 0, noiseType, frequencyScale, offset } noise sampled at (coordinate * frequencyScale + offset)
+  //   Constant { 1, value }
+  //   Add, Multiply, Min, Max { op, a, b }
+  //   Clamp    { 6, a, min, max }
+  //   Select   { 7, a, b, control } a where control <= 0, b elsewhere
+  // a, b, min, max and control are indices of earlier nodes, the last node is the graph's output
+  // Sources use the current fractal and cellular settings. Returns false for invalid graphs
+  bool SetGraph(const WN_DECIMAL *nodes, uint32 nodeCount);
+  void ClearGraph();
+
+  WN_DECIMAL  GetGraph(WN_DECIMAL x, WN_DECIMAL y);
+  WN_DECIMAL *GetGraphStrip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, StripDirection direction);
+  WN_DECIMAL *GetGraphSquare(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height);
+#endif // WN_INCLUDE_GRAPH
+
+#ifdef WN_INCLUDE_MESH
+  // Marching cubes surface at isoLevel through a width*height*depth grid of samples of a noise set, 
+  // spaced like a cube's. Samples are generated a slab at a time and never stored as a cube. Returns 
+  // the vertex buffer, GetMeshVertexCount vertices of MeshVertexStride decimals (position, then unit 
+  // normal pointing to the side below isoLevel), with GetMeshIndexCount indices making triangles 
+  // which wind counter-clockwise seen from that side. Both buffers are reused by the next mesh
+  WN_DECIMAL *GetIsoSurface(NoiseType noiseType, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel);
+  // The same over a row-major cube which has already been generated, positions are in samples
+  WN_DECIMAL *GetIsoSurfaceFromCube(const WN_DECIMAL *values, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel);
+  static constexpr uint32 MeshVertexStride = 6;
+  WN_DECIMAL *GetMeshVertices() const { return meshVertices; }
+  uint32 GetMeshVertexCount() const { return meshVertexCount; }
+  uint32 *GetMeshIndices() const { return meshIndices; }
+  uint32 GetMeshIndexCount() const { return meshIndexCount; }
+#endif // WN_INCLUDE_MESH
+
 private:
-  ReturnArrayHelper returnHelper;
+  ReturnArrayHelper<> returnHelper;
+  ReturnArrayHelper<uint32> maskHelper;
+  ReturnArrayHelper<uint32> offsetHelper;
+  ReturnArrayHelper<> coarseHelper;
+  ReturnArrayHelper<uint8> knownHelper;
+  ReturnArrayHelper<> octaveHelper;
 
   uint8 perm[512];
   uint8 perm12[512];
@@ -253,11 +611,76 @@ private:
   int32 cellularDistanceIndex0;
   int32 cellularDistanceIndex1;
   static constexpr int32 CellularDistanceIndexMax = 3;
+  // Absorbs rounding in the 3D cellular search bounds
+  static constexpr WN_DECIMAL CellularBoundSlack = WN_DECIMAL(1e-4);
   WN_DECIMAL cellularJitter;
   WN_DECIMAL cellularNoiseLookupFrequency;
 
+  WN_DECIMAL sampleStepX;
+  WN_DECIMAL sampleStepY;
+  WN_DECIMAL sampleStepZ;
+  WN_DECIMAL sampleStepW;
+
+  OutputLayout outputLayout;
+  uint32 outputRowStride;
+  WN_DECIMAL *outputTarget;
+  uint32 outputTargetPitch;
+  uint32 outputTargetRows;
+  uint32 outputTargetX;
+  uint32 outputTargetY;
+  const uint32 *sampleMask;
+  WN_DECIMAL sampleMaskFill;
+  int32 periodX;
+  int32 periodY;
+  int32 periodZ;
+  int32 latticeOriginX;
+  int32 latticeOriginY;
+  int32 latticeOriginZ;
+  uint32 cubeSubsampleX;
+  uint32 cubeSubsampleY;
+  uint32 cubeSubsampleZ;
+  WN_DECIMAL adaptiveTolerance;
+  uint32 adaptiveSampleCount;
+
+  // Chunk origin and periods of each fractal octave, worked out by the setters. Fractals scale both 
+  // along with the coordinates for each octave, so every octave tiles once per period of the first. 
+  // Only a whole number lacunarity scales them: a chunk origin with any other lacunarity aborts and 
+  // is left unscaled, periods are left unscaled and the detail octaves stop tiling
+  struct LatticeOctave
+  {
+    int32 originX, originY, originZ;
+    int32 periodX, periodY, periodZ;
+  };
+  LatticeOctave *latticeOctaves;
+  // Octave the kernels are looking up, only read by the Shifted kernels
+  const LatticeOctave *lattice;
+  // Any chunk origin or period is set, the kernels pick their Shifted variant once per call
+  bool latticeShifted;
+
+  // Steps the lattice through the octaves of a fractal and puts it back to the first when done
+  class OctaveOrigin
+  {
+  public:
+    OctaveOrigin(WasmNoise &_noise) : noise(_noise) {}
+    ~OctaveOrigin() { noise.lattice = noise.latticeOctaves; }
+    WN_INLINE void Next() { noise.lattice++; }
+  private:
+    WasmNoise &noise;
+  };
+  WN_INLINE bool HasChunkOrigin() const { return (latticeOriginX | latticeOriginY | latticeOriginZ) != 0; }
+  // The fractal lacunarity as an integer when it's a whole number, 0 otherwise
+  WN_INLINE int32 WholeLacunarity() const
+  {
+    int32 lacunarity = static_cast<int32>(fractalLacunarity);
+    return (static_cast<WN_DECIMAL>(lacunarity) == fractalLacunarity) ? lacunarity : 0;
+  }
+  WN_DECIMAL *remapLUT;
+  uint32 remapLUTCount;
+  WN_DECIMAL remapLUTScale;
+
   void CalculateFractalBounding();
   void CalculateFractalExponents();
+  void CalculateLatticeOctaves();
 
   using Single2DFPtr = WN_DECIMAL(WasmNoise::*)(uint8, WN_DECIMAL, WN_DECIMAL) const; 
   using Single3DFPtr = WN_DECIMAL(WasmNoise::*)(uint8, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL) const;
@@ -265,29 +688,219 @@ private:
   using FPtr2D = WN_DECIMAL(WasmNoise::*)(WN_DECIMAL, WN_DECIMAL);
   using FPtr3D = WN_DECIMAL(WasmNoise::*)(WN_DECIMAL, WN_DECIMAL, WN_DECIMAL);
   using FPtr4D = WN_DECIMAL(WasmNoise::*)(WN_DECIMAL, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL);
+  using OctavesFPtr2D = void(WasmNoise::*)(WN_DECIMAL*, WN_DECIMAL, WN_DECIMAL);
+  using SingleRow2DFPtr = void(WasmNoise::*)(uint8, WN_DECIMAL*, uint32, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL) const;
+  using SingleRow3DFPtr = void(WasmNoise::*)(uint8, WN_DECIMAL*, uint32, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL) const;
+  using RowFPtr2D = void(WasmNoise::*)(WN_DECIMAL*, uint32, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL);
+  using RowFPtr3D = void(WasmNoise::*)(WN_DECIMAL*, uint32, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL, WN_DECIMAL);
+
+  // Kernels known at compile time are passed to the templates below as empty functor types, so
+  // each instantiation calls its kernel directly and can inline it into the loop body. Plain
+  // function pointers are still accepted for kernels picked at runtime (viewport and graph)
+  template<class FuncPtr, FuncPtr Func> struct Kernel
+  {
+    template<class... Args> WN_INLINE auto operator()(WasmNoise &noise, Args... args) const { return (noise.*Func)(args...); }
+  };
+  template<Single2DFPtr Func> using Single2DKernel = Kernel<Single2DFPtr, Func>;
+  template<Single3DFPtr Func> using Single3DKernel = Kernel<Single3DFPtr, Func>;
+  template<Single4DFPtr Func> using Single4DKernel = Kernel<Single4DFPtr, Func>;
+  template<FPtr2D Func> using Kernel2D = Kernel<FPtr2D, Func>;
+  template<FPtr3D Func> using Kernel3D = Kernel<FPtr3D, Func>;
+  template<FPtr4D Func> using Kernel4D = Kernel<FPtr4D, Func>;
+  template<OctavesFPtr2D Func> using OctavesKernel2D = Kernel<OctavesFPtr2D, Func>;
+  template<SingleRow2DFPtr Func> using SingleRow2DKernel = Kernel<SingleRow2DFPtr, Func>;
+  template<SingleRow3DFPtr Func> using SingleRow3DKernel = Kernel<SingleRow3DFPtr, Func>;
+  template<RowFPtr2D Func> using RowKernel2D = Kernel<RowFPtr2D, Func>;
+  template<RowFPtr3D Func> using RowKernel3D = Kernel<RowFPtr3D, Func>;
 
   // GetStrip/Square/Cube Templates
-  template<class NoiseFunc=FPtr2D> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY);
-  template<class NoiseFunc=FPtr3D> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
-  template<class NoiseFunc=FPtr4D> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetStrip(NoiseFunc func, uint32 length, StripDirection direction, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW);
 
-  template<class NoiseFunc=FPtr2D> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
-  template<class NoiseFunc=FPtr3D> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
-  template<class NoiseFunc=FPtr4D> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetSquare(NoiseFunc func, uint32 width, uint32 height, SquarePlane plane, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW);
 
-  template<class NoiseFunc=FPtr3D> WN_INLINE WN_DECIMAL *GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
-  template<class NoiseFunc=FPtr4D> WN_INLINE WN_DECIMAL *GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW); 
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW); 
 
-#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL) || defined(WN_INCLUDE_CELLULAR_FRACTAL)
+  // Masked squares and cubes evaluate the set samples MaskChunkLength at a time, gathered from the 
+  // mask so the evaluation loop doesn't branch on it
+  static constexpr uint32 MaskChunkLength = 64;
+  WN_INLINE bool IsMasked(uint32 i) const { return (sampleMask[i >> 5] >> (i & 31)) & 1; }
+  // Collects the indices of up to MaskChunkLength set samples in [next, count), moving next past them
+  WN_INLINE uint32 CompactMask(uint32 &next, uint32 count, uint32 *indices) const;
+  // Writes the fill value to the samples which aren't set
+  WN_INLINE void FillUnmasked(WN_DECIMAL *values, uint32 width, uint32 height, uint32 depth) const;
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetMaskedSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetMaskedCube(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+
+  // Adaptive 2D squares, the samples of a square are evaluated into values on demand, known marking
+  // the ones that have been
+  static constexpr uint32 AdaptiveBlockSize = 16;
+  struct AdaptiveGrid
+  {
+    WN_DECIMAL *values;
+    uint8 *known;
+    uint32 width;
+    WN_DECIMAL startX;
+    WN_DECIMAL startY;
+  };
+  // Adapts a row kernel to the single sample calls of adaptive squares
+  template<class RowFunc> struct RowSample
+  {
+    RowFunc func;
+    WN_INLINE WN_DECIMAL operator()(WasmNoise &noise, WN_DECIMAL x, WN_DECIMAL y) const { WN_DECIMAL value; invoke(func, noise, &value, 1, x, WN_DECIMAL(0), y); return value; }
+  };
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL *GetAdaptiveSquare(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class NoiseFunc> void RefineAdaptiveBlock(NoiseFunc func, AdaptiveGrid &grid, uint32 x0, uint32 y0, uint32 x1, uint32 y1);
+  template<class NoiseFunc> WN_INLINE WN_DECIMAL AdaptiveSample(NoiseFunc func, AdaptiveGrid &grid, uint32 x, uint32 y);
+
+#if defined(WN_INCLUDE_VALUE) || defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+  // Row-incremental Square/Cube templates, for noise with a row kernel which fills a run of samples 
+  // along the X axis at once. Rows are handed out in chunks of at most RowChunkLength samples
+  static constexpr uint32 RowChunkLength = 64;
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetCubeRows(RowFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+  // Masked rows are evaluated one run of set samples at a time
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetMaskedSquareRows(RowFunc func, uint32 width, uint32 height, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetMaskedCubeRows(RowFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+#endif
+
+#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL)
+  // Mip chain of 2D fractal squares, level n is sampled every 2^n samples with n fewer octaves
+  template<class OctavesFunc> WN_INLINE WN_DECIMAL *GetSquarePyramid(OctavesFunc func, uint32 width, uint32 height, uint32 levels, WN_DECIMAL startX, WN_DECIMAL startY);
+#endif
+#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL) || defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+  // Threshold masks of the fractal built from a single noise function (not a fractal function)
+  template<class NoiseFunc> WN_INLINE uint32 *GetSquareMask(NoiseFunc func, uint32 width, uint32 height, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY);
+  template<class NoiseFunc> WN_INLINE uint32 *GetCubeMask(NoiseFunc func, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+#endif
+
+#if defined(WN_INCLUDE_VIEWPORT) || defined(WN_INCLUDE_GRAPH) || defined(WN_INCLUDE_MESH)
+  // Returns the FPtr2D or FPtr3D function for a noise set using the current fractal/cellular
+  // settings, or nullptr if the set isn't included in this build
+  template<class FuncPtr> FuncPtr GetNoiseFunc(NoiseType noiseType) const;
+#endif
+
+#ifdef WN_INCLUDE_VIEWPORT
+  ReturnArrayHelper<> viewportHelper;
+  FPtr2D viewportFunc;
+  WN_DECIMAL *viewportValues;
+  uint32 viewportWidth;
+  uint32 viewportHeight;
+  WN_DECIMAL viewportStartX;
+  WN_DECIMAL viewportStartY;
+  int32 viewportX;
+  int32 viewportY;
+
+  // Fills the samples [fromX, toX) x [fromY, toY), relative to the viewport start, into the ring buffer
+  void FillViewport(int32 fromX, int32 toX, int32 fromY, int32 toY);
+#endif // WN_INCLUDE_VIEWPORT
+
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+  ReturnArrayHelper<uint32> sparseHelper;
+  uint32 *sparseBrickMap;
+  uint32 sparseBrickCount;
+#endif // WN_INCLUDE_VALUE_FRACTAL
+
+#ifdef WN_INCLUDE_GRAPH
+  struct GraphNode
+  {
+    GraphOp op;
+    uint32 input0;
+    uint32 input1;
+    uint32 input2;
+    NoiseType noiseType;
+    FPtr2D func;
+    WN_DECIMAL value;
+    WN_DECIMAL frequencyScale;
+    WN_DECIMAL offset;
+  };
+  // Graphs are evaluated this many samples at a time
+  static constexpr uint32 GraphChunkLength = 64;
+
+  GraphNode *graphNodes;
+  uint32 graphNodeCount;
+  // GraphChunkLength values per node
+  WN_DECIMAL *graphScratch;
+
+  // Looks up the source functions again, picking up any changed fractal/cellular settings
+  void UpdateGraphSources();
+  // Evaluates the graph at length (<= GraphChunkLength) frequency-scaled coordinates, returns the output chunk
+  WN_DECIMAL *EvaluateGraph(const WN_DECIMAL *xs, const WN_DECIMAL *ys, uint32 length);
+#endif // WN_INCLUDE_GRAPH
+
+#ifdef WN_INCLUDE_MESH
+  // Triangles for each marching cubes case as edge indices, terminated by -1
+  static constexpr uint32 MeshCaseLength = 16;
+  static constexpr uint32 MeshInitialCapacity = 1024;
+  int8 meshTriangles[256][MeshCaseLength];
+  WN_DECIMAL *meshVertices;
+  uint32 meshVertexCount;
+  uint32 meshVertexCapacity;
+  uint32 *meshIndices;
+  uint32 meshIndexCount;
+  uint32 meshIndexCapacity;
+  ReturnArrayHelper<> meshSlabHelper;
+  ReturnArrayHelper<uint32> meshEdgeHelper;
+
+  // Ring of four slabs of (width + 2) * (height + 2) samples, slab z holds plane z of the grid with 
+  // an apron of one sample, for z from -1 to depth
+  struct MeshVolume
+  {
+    WN_DECIMAL *slabs;
+    uint32 slabSize;
+    uint32 pitch;
+    int32 width;
+    int32 height;
+    WN_DECIMAL isoLevel;
+    WN_DECIMAL origin[3];
+    WN_DECIMAL step[3];
+
+    WN_INLINE WN_DECIMAL *Slab(int32 z) const { return slabs + ((z + 1) & 3) * slabSize; }
+    WN_INLINE WN_DECIMAL Value(int32 x, int32 y, int32 z) const { return Slab(z)[(y + 1) * pitch + (x + 1)]; }
+  };
+
+  void BuildMeshTables();
+  template<class T> static T *GrowMeshBuffer(T *buffer, uint32 count, uint32 &capacity, uint32 recordLength);
+  WN_INLINE uint32 AddMeshVertex(const MeshVolume &volume, int32 x, int32 y, int32 z, uint32 axis);
+  WN_INLINE void AddMeshPlaneVertices(const MeshVolume &volume, int32 z, uint32 *edgesX, uint32 *edgesY);
+  // fillSlab(z, slab) writes slab z, see MeshVolume
+  template<class SlabFunc> WN_INLINE WN_DECIMAL *GetMesh(SlabFunc fillSlab, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel, const WN_DECIMAL *origin, const WN_DECIMAL *step);
+#endif // WN_INCLUDE_MESH
+
+#if defined(WN_INCLUDE_PERLIN_FRACTAL) || defined(WN_INCLUDE_SIMPLEX_FRACTAL) || defined(WN_INCLUDE_CELLULAR_FRACTAL) || defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC_FRACTAL)
   // Fractal templates
   template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL SingleFractalFBM(NoiseFunc func, Args... args);
   template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL SingleFractalBillow(NoiseFunc func, Args... args);
   template<class NoiseFunc, class... Args> WN_INLINE WN_DECIMAL SingleFractalRidgedMulti(NoiseFunc func, Args... args);
+
+  // Write the running (unscaled) fractal sum after each octave into octaveSums
+  template<class NoiseFunc, class... Args> WN_INLINE void SingleFractalFBMOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args);
+  template<class NoiseFunc, class... Args> WN_INLINE void SingleFractalBillowOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args);
+  template<class NoiseFunc, class... Args> WN_INLINE void SingleFractalRidgedMultiOctaves(NoiseFunc func, WN_DECIMAL *octaveSums, Args... args);
+
+  // Whether the fractal is above threshold, skipping the octaves which can't change the answer
+  template<class NoiseFunc, class... Args> WN_INLINE bool SingleFractalAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args);
+  template<class NoiseFunc, class... Args> WN_INLINE bool SingleFractalFBMAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args);
+  template<class NoiseFunc, class... Args> WN_INLINE bool SingleFractalBillowAbove(NoiseFunc func, WN_DECIMAL threshold, Args... args);
+#endif
+
+#if defined(WN_INCLUDE_VALUE_FRACTAL) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+  // Evaluate a run of up to RowChunkLength samples at once using a row kernel
+  template<class RowFunc, class... Args> WN_INLINE void SingleFractalFBMRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args);
+  template<class RowFunc, class... Args> WN_INLINE void SingleFractalBillowRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args);
+  template<class RowFunc, class... Args> WN_INLINE void SingleFractalRidgedMultiRow(RowFunc func, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, Args... args);
 #endif
 
 #if defined(WN_INCLUDE_PERLIN) || defined(WN_INCLUDE_PERLIN_FRACTAL)
   // Regular Perlin Noise Functions, necessary for both regular and fractal functions
+  template<bool Shifted> WN_INLINE WN_DECIMAL SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
   WN_INLINE WN_DECIMAL SinglePerlin(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;  
   WN_INLINE WN_DECIMAL SinglePerlinNoOffset(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SinglePerlinNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
@@ -299,6 +912,9 @@ private:
   WN_INLINE WN_DECIMAL SinglePerlinFractalFBM(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SinglePerlinFractalBillow(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SinglePerlinFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SinglePerlinFractalFBMOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SinglePerlinFractalBillowOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SinglePerlinFractalRidgedMultiOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
 
   // 3D
   WN_INLINE WN_DECIMAL SinglePerlinFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
@@ -308,8 +924,11 @@ private:
 
 #if defined(WN_INCLUDE_SIMPLEX) || defined(WN_INCLUDE_SIMPLEX_FRACTAL)
   // Regular Simplex Noise Functions, necessary for both regular and fractal functions
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
   WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const;
   WN_INLINE WN_DECIMAL SingleSimplex(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const;
   WN_INLINE WN_DECIMAL SingleSimplexNoOffset(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SingleSimplexNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
@@ -322,6 +941,9 @@ private:
   WN_INLINE WN_DECIMAL SingleSimplexFractalFBM(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SingleSimplexFractalBillow(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SingleSimplexFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SingleSimplexFractalFBMOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SingleSimplexFractalBillowOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SingleSimplexFractalRidgedMultiOctaves(WN_DECIMAL *octaveSums, WN_DECIMAL x, WN_DECIMAL y);
 
   // 3D
   WN_INLINE WN_DECIMAL SingleSimplexFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
@@ -334,20 +956,152 @@ private:
   WN_INLINE WN_DECIMAL SingleSimplexFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
 #endif // WN_INCLUDE_SIMPLEX_FRACTAL
 
+#if defined(WN_INCLUDE_VALUE) || defined(WN_INCLUDE_VALUE_FRACTAL)
+  // Regular Value Noise Functions, necessary for both regular and fractal functions
+  WN_INLINE WN_DECIMAL Interpolate(WN_DECIMAL t) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const;
+  WN_INLINE WN_DECIMAL SingleValue(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) const;
+  WN_INLINE WN_DECIMAL SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleValueNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+
+  // Row kernels, fill values[i] with the noise at (x + i * xStep, y[, z])
+  template<bool Shifted> WN_INLINE void SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const;
+  WN_INLINE void SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE void SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE void SingleValueRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE void SingleValueRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleValueRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+#endif
+
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+  // Fractal Value Noise Functions
+  // 2D
+  WN_INLINE WN_DECIMAL SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SingleValueFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleValueFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleValueFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+
+  // 3D
+  WN_INLINE WN_DECIMAL SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleValueFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleValueFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleValueFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+  static constexpr int32 SparseBoundsMaxCells = 4;
+  static constexpr WN_DECIMAL SparseBoundsEpsilon = WN_DECIMAL(1e-5);
+  // Value range over a box of lattice space, for one octave and for the whole fractal
+  WN_INLINE void ValueLatticeBounds(uint8 offset, const WN_DECIMAL *lo, const WN_DECIMAL *hi, WN_DECIMAL &minValue, WN_DECIMAL &maxValue) const;
+  WN_INLINE void ValueFractalBounds(WN_DECIMAL *lo, WN_DECIMAL *hi, WN_DECIMAL &minValue, WN_DECIMAL &maxValue);
+  template<class RowFunc> WN_INLINE WN_DECIMAL *GetValueSparseCube(RowFunc func, bool bounded, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ);
+
+  // 4D
+  WN_INLINE WN_DECIMAL SingleValueFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+  WN_INLINE WN_DECIMAL SingleValueFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+  WN_INLINE WN_DECIMAL SingleValueFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+#endif // WN_INCLUDE_VALUE_FRACTAL
+
+#if defined(WN_INCLUDE_CUBIC) || defined(WN_INCLUDE_CUBIC_FRACTAL)
+  // Regular Cubic Noise Functions, necessary for both regular and fractal functions
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  WN_INLINE WN_DECIMAL SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE WN_DECIMAL SingleCubic(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE WN_DECIMAL SingleCubicNoOffset(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleCubicNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+
+  // Row kernels, fill values[i] with the noise at (x + i * xStep, y[, z])
+  template<bool Shifted> WN_INLINE void SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const;
+  WN_INLINE void SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE void SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE void SingleCubicRow(uint8 offset, WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z) const;
+  WN_INLINE void SingleCubicRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleCubicRowNoOffset(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+#endif
+
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+  // Fractal Cubic Noise Functions
+  // 2D
+  WN_INLINE WN_DECIMAL SingleCubicFractalFBM(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleCubicFractalBillow(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleCubicFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE void SingleCubicFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleCubicFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+  WN_INLINE void SingleCubicFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y);
+
+  // 3D
+  WN_INLINE WN_DECIMAL SingleCubicFractalFBM(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleCubicFractalBillow(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleCubicFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleCubicFractalFBMRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleCubicFractalBillowRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE void SingleCubicFractalRidgedMultiRow(WN_DECIMAL *values, uint32 length, WN_DECIMAL x, WN_DECIMAL xStep, WN_DECIMAL y, WN_DECIMAL z);
+#endif // WN_INCLUDE_CUBIC_FRACTAL
+
+#ifdef WN_INCLUDE_WHITE
+  WN_INLINE WN_DECIMAL SingleWhite(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleWhite(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+  WN_INLINE WN_DECIMAL SingleWhite(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w);
+
+  // Fills a width*height*depth grid of integer coordinates starting at start, stepping along uAxis, then
+  // vAxis, then wAxis. Axes are 0-3 for x-w, passing dimensions as an axis leaves it unused
+  WN_INLINE WN_DECIMAL *GetWhiteIntGrid(const int32 *start, uint32 dimensions, uint32 uAxis, uint32 width, uint32 vAxis, uint32 height, uint32 wAxis, uint32 depth);
+#endif // WN_INCLUDE_WHITE
+
 #if defined(WN_INCLUDE_CELLULAR) || defined(WN_INCLUDE_CELLULAR_FRACTAL)
   // 2D
+  // Returns the distance to the nearest cell and its lattice coordinates
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, int32 &xc, int32 &yc) const;
+  WN_INLINE WN_DECIMAL SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, int32 &xc, int32 &yc) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL CellularNoiseLookup(uint8 offset, int32 xc, int32 yc) const;
+  WN_INLINE WN_DECIMAL CellularNoiseLookup(uint8 offset, int32 xc, int32 yc) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y) const;
   WN_INLINE WN_DECIMAL SingleCellularNoOffset(WN_DECIMAL x, WN_DECIMAL y);
   WN_INLINE WN_DECIMAL SingleCellular2EdgeNoOffset(WN_DECIMAL x, WN_DECIMAL y);
+  // Fills distance up to cellularDistanceIndex1 like SingleCellular2Edge and finds the nearest cell 
+  // like SingleCellular
+  template<bool Shifted> WN_INLINE void SingleCellularSearch(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL *distance, int32 &xc, int32 &yc) const;
+  // Fills the GetCellularSquareOutputs planes, unused ones are null
+  template<bool Shifted> WN_INLINE void FillCellularOutputs(WN_DECIMAL *const *planes, WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) const;
 
   // 3D
+  WN_INLINE void CellularSearchAxis(WN_DECIMAL v, int32 *cells, WN_DECIMAL *bounds) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, int32 &xc, int32 &yc, int32 &zc) const;
+  WN_INLINE WN_DECIMAL SingleCellularNearest(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, int32 &xc, int32 &yc, int32 &zc) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL CellularNoiseLookup(uint8 offset, int32 xc, int32 yc, int32 zc) const;
+  WN_INLINE WN_DECIMAL CellularNoiseLookup(uint8 offset, int32 xc, int32 yc, int32 zc) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
   WN_INLINE WN_DECIMAL SingleCellular(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
   WN_INLINE WN_DECIMAL SingleCellular2Edge(uint8 offset, WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) const;
   WN_INLINE WN_DECIMAL SingleCellularNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
   WN_INLINE WN_DECIMAL SingleCellular2EdgeNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
 #endif // WN_INCLUDE_CELLULAR || WN_INCLUDE_CELLULAR_FRACTAL
 
+#ifdef WN_INCLUDE_CELLULAR
+  // Noise lookup results per cell for the bulk functions, indexed by the low bits of the cell coordinates
+  static constexpr uint32 CellularCacheSize = 256;
+  uint8 cellularCacheValid[CellularCacheSize];
+  int32 cellularCacheX[CellularCacheSize];
+  int32 cellularCacheY[CellularCacheSize];
+  int32 cellularCacheZ[CellularCacheSize];
+  WN_DECIMAL cellularCacheValue[CellularCacheSize];
+
+  WN_INLINE void ClearCellularCache();
+  WN_INLINE WN_DECIMAL SingleCellularCachedNoOffset(WN_DECIMAL x, WN_DECIMAL y);
+  WN_INLINE WN_DECIMAL SingleCellularCachedNoOffset(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
+#endif // WN_INCLUDE_CELLULAR
+
 #ifdef WN_INCLUDE_CELLULAR_FRACTAL
   // 2D
   WN_INLINE WN_DECIMAL SingleCellularFractalFBM(WN_DECIMAL x, WN_DECIMAL y);
@@ -366,16 +1120,61 @@ private:
   WN_INLINE WN_DECIMAL SingleCellular2EdgeFractalRidgedMulti(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z);
 #endif
 
-  WN_INLINE uint8 Index2D_12(uint8 offset, int32 x, int32 y) const;
-  WN_INLINE uint8 Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const;
-  WN_INLINE uint8 Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
-  WN_INLINE uint8 Index2D_256(uint8 offset, int32 x, int32 y) const;
-  WN_INLINE uint8 Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const;
-  WN_INLINE uint8 Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+  // Lattice coordinate after the current octave's chunk origin and period are applied, or as is when 
+  // not Shifted. Kernels which look up the lattice are templated the same way, with an overload 
+  // which picks the variant from latticeShifted once per call so plain noise never pays for either
+  template<bool Shifted> WN_INLINE int32 LatticeX(int32 x) const;
+  template<bool Shifted> WN_INLINE int32 LatticeY(int32 y) const;
+  template<bool Shifted> WN_INLINE int32 LatticeZ(int32 z) const;
+
+  template<bool Shifted> WN_INLINE uint8 Index2D_12(uint8 offset, int32 x, int32 y) const;
+  template<bool Shifted> WN_INLINE uint8 Index3D_12(uint8 offset, int32 x, int32 y, int32 z) const;
+  template<bool Shifted> WN_INLINE uint8 Index4D_32(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+  template<bool Shifted> WN_INLINE uint8 Index2D_256(uint8 offset, int32 x, int32 y) const;
+  template<bool Shifted> WN_INLINE uint8 Index3D_256(uint8 offset, int32 x, int32 y, int32 z) const;
+  template<bool Shifted> WN_INLINE uint8 Index4D_256(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+
+  // Lattice rows let the row kernels do the Y (and Z) part of a lookup once per row
+#ifdef WN_USE_HASH_LATTICE
+  using LatticeRow = int32;
+  WN_INLINE int32 LatticeSeed(uint8 offset) const;
+#else
+  using LatticeRow = const uint8 *;
+#endif
+  template<bool Shifted> WN_INLINE LatticeRow RowLookup(uint8 offset, int32 y) const;
+  template<bool Shifted> WN_INLINE LatticeRow RowLookup(uint8 offset, int32 y, int32 z) const;
+  template<bool Shifted> WN_INLINE uint8 RowIndex_256(LatticeRow row, int32 x) const;
+
+  template<bool Shifted> WN_INLINE WN_DECIMAL GradCoord2D(uint8 offset, int32 x, int32 y, WN_DECIMAL xd, WN_DECIMAL yd) const;  
+  template<bool Shifted> WN_INLINE WN_DECIMAL GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd, WN_DECIMAL wd) const;
+
+  template<bool Shifted> WN_INLINE WN_DECIMAL ValCoord2DFast(uint8 offset, int32 x, int32 y) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL ValCoord3DFast(uint8 offset, int32 x, int32 y, int32 z) const;
+  template<bool Shifted> WN_INLINE WN_DECIMAL ValCoord4DFast(uint8 offset, int32 x, int32 y, int32 z, int32 w) const;
+
+  // Applies the remap curve, if any
+  WN_INLINE WN_DECIMAL Remap(WN_DECIMAL value) const;
+
+  // Output layout of a width*height*depth block, squares pass a depth of 1
+  WN_INLINE bool IsValidLayout(uint32 width, uint32 height, uint32 depth) const;
+  // Number of values needed to hold the block, including row stride padding
+  WN_INLINE uint32 LayoutSize(uint32 width, uint32 height, uint32 depth) const;
+  // Distance between the starts of row-major rows, from the output target or row stride
+  WN_INLINE uint32 LayoutRowStride(uint32 width) const;
+  // Returns where a block's values are written, the output target or a new array
+  WN_INLINE WN_DECIMAL *NewOutput(uint32 width, uint32 height, uint32 depth);
+  // Offset contributed by coordinate i along axis (0-2 for x-z), an element is stored at the sum of its 3 offsets
+  WN_INLINE uint32 LayoutOffset(uint32 axis, uint32 i, uint32 width, uint32 height, uint32 depth) const;
+  // X offsets of every column of a square, so the sample loops only add them to each row's offset
+  WN_INLINE const uint32 *ColumnOffsets(uint32 width, uint32 height);
 
-  WN_INLINE WN_DECIMAL GradCoord2D(uint8 offset, int32 x, int32 y, WN_DECIMAL xd, WN_DECIMAL yd) const;  
-  WN_INLINE WN_DECIMAL GradCoord3D(uint8 offset, int32 x, int32 y, int32 z, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd) const;
-  WN_INLINE WN_DECIMAL GradCoord4D(uint8 offset, int32 x, int32 y, int32 z, int32 w, WN_DECIMAL xd, WN_DECIMAL yd, WN_DECIMAL zd, WN_DECIMAL wd) const;
+  // Subsampled cubes evaluate a coarse grid holding every subsample'th sample along each axis, plus
+  // one past the last sample when it doesn't land on the grid
+  WN_INLINE bool IsCubeSubsampled() const { return cubeSubsampleX != 1 || cubeSubsampleY != 1 || cubeSubsampleZ != 1; }
+  WN_INLINE uint32 CoarseCount(uint32 count, uint32 subsample) const { return (count + subsample - 2) / subsample + 1; }
+  // Interpolates the coarse grid into the cube's output
+  WN_INLINE WN_DECIMAL *UpsampleCube(const WN_DECIMAL *coarse, uint32 width, uint32 height, uint32 depth);
 };
 
 // Declare some log functions as extern so we can call them in WasmNoise.cpp 
@@ -27,6 +27,48 @@ extern "C"
   void SetInterp(int32 _interp) { wasmNoise.SetInterp(static_cast<WasmNoise::Interp>(_interp)); }
   int32 GetInterp() { return static_cast<int32>(wasmNoise.GetInterp()); }
 
+  void SetSampleStep(WN_DECIMAL _sampleStepX, WN_DECIMAL _sampleStepY, WN_DECIMAL _sampleStepZ, WN_DECIMAL _sampleStepW) { wasmNoise.SetSampleStep(_sampleStepX, _sampleStepY, _sampleStepZ, _sampleStepW); }
+  WN_DECIMAL GetSampleStepX() { return wasmNoise.GetSampleStepX(); }
+  WN_DECIMAL GetSampleStepY() { return wasmNoise.GetSampleStepY(); }
+  WN_DECIMAL GetSampleStepZ() { return wasmNoise.GetSampleStepZ(); }
+  WN_DECIMAL GetSampleStepW() { return wasmNoise.GetSampleStepW(); }
+
+  void SetOutputLayout(int32 _outputLayout) { wasmNoise.SetOutputLayout(static_cast<WasmNoise::OutputLayout>(_outputLayout)); }
+  int32 GetOutputLayout() { return static_cast<int32>(wasmNoise.GetOutputLayout()); }
+
+  void SetOutputRowStride(uint32 _outputRowStride) { wasmNoise.SetOutputRowStride(_outputRowStride); }
+  uint32 GetOutputRowStride() { return wasmNoise.GetOutputRowStride(); }
+
+  void SetOutputTarget(WN_DECIMAL *dest, uint32 pitch, uint32 rows, uint32 offsetX, uint32 offsetY) { wasmNoise.SetOutputTarget(dest, pitch, rows, offsetX, offsetY); }
+  void ClearOutputTarget() { wasmNoise.ClearOutputTarget(); }
+
+  void SetSampleMask(const uint32 *mask, WN_DECIMAL fill) { wasmNoise.SetSampleMask(mask, fill); }
+  void ClearSampleMask() { wasmNoise.ClearSampleMask(); }
+
+  void SetPeriod(int32 _periodX, int32 _periodY, int32 _periodZ) { wasmNoise.SetPeriod(_periodX, _periodY, _periodZ); }
+  int32 GetPeriodX() { return wasmNoise.GetPeriodX(); }
+  int32 GetPeriodY() { return wasmNoise.GetPeriodY(); }
+  int32 GetPeriodZ() { return wasmNoise.GetPeriodZ(); }
+
+  void SetChunkOrigin(int32 chunkX, int32 chunkY, int32 chunkZ, int32 chunkCells) { wasmNoise.SetChunkOrigin(chunkX, chunkY, chunkZ, chunkCells); }
+  void ClearChunkOrigin() { wasmNoise.ClearChunkOrigin(); }
+
+  void SetCubeSubsample(uint32 _subsampleX, uint32 _subsampleY, uint32 _subsampleZ) { wasmNoise.SetCubeSubsample(_subsampleX, _subsampleY, _subsampleZ); }
+  uint32 GetCubeSubsampleX() { return wasmNoise.GetCubeSubsampleX(); }
+  uint32 GetCubeSubsampleY() { return wasmNoise.GetCubeSubsampleY(); }
+  uint32 GetCubeSubsampleZ() { return wasmNoise.GetCubeSubsampleZ(); }
+
+  void SetAdaptiveTolerance(WN_DECIMAL _adaptiveTolerance) { wasmNoise.SetAdaptiveTolerance(_adaptiveTolerance); }
+  WN_DECIMAL GetAdaptiveTolerance() { return wasmNoise.GetAdaptiveTolerance(); }
+  uint32 GetAdaptiveSampleCount() { return wasmNoise.GetAdaptiveSampleCount(); }
+
+  void SetRemapLUT(const WN_DECIMAL *lut, uint32 count) { wasmNoise.SetRemapLUT(lut, count); }
+  void ClearRemap() { wasmNoise.ClearRemap(); }
+
+  // Allocates memory in linear memory for passing arrays (e.g. point coordinates) in from javascript
+  void *AllocateBuffer(uint32 bytes) { return malloc(bytes); }
+  void FreeBuffer(void *buffer) { free(buffer); }
+
 #ifdef WN_INCLUDE_FRACTAL_GETSET
   void SetFractalOctaves(uint32 _octaves) { wasmNoise.SetFractalOctaves(_octaves); }
   uint32 GetFractalOctaves() { return wasmNoise.GetFractalOctaves(); }
@@ -77,11 +119,14 @@ extern "C"
   WN_INLINE WN_DECIMAL  GetPerlinFractal2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetPerlinFractal(x, y); }
   WN_INLINE WN_DECIMAL *GetPerlinFractal2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetPerlinFractalStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
   WN_INLINE WN_DECIMAL *GetPerlinFractal2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, uint32 height) { return wasmNoise.GetPerlinFractalSquare(startX, startY, length, height); }
+  WN_INLINE WN_DECIMAL *GetPerlinFractal2_SquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels) { return wasmNoise.GetPerlinFractalSquarePyramid(startX, startY, width, height, levels); }
 
   WN_INLINE WN_DECIMAL  GetPerlinFractal3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetPerlinFractal(x, y, z); }
   WN_INLINE WN_DECIMAL *GetPerlinFractal3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetPerlinFractalStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
   WN_INLINE WN_DECIMAL *GetPerlinFractal3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetPerlinFractalSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
   WN_INLINE WN_DECIMAL *GetPerlinFractal3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetPerlinFractalCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE uint32 *GetPerlinFractal2_SquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold) { return wasmNoise.GetPerlinFractalSquareMask(startX, startY, width, height, threshold); }
+  WN_INLINE uint32 *GetPerlinFractal3_CubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold) { return wasmNoise.GetPerlinFractalCubeMask(startX, startY, startZ, width, height, depth, threshold); }
 #endif // WN_INCLUDE_PERLIN_FRACTAL
 #ifdef WN_INCLUDE_SIMPLEX
   WN_INLINE WN_DECIMAL  GetSimplex2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetSimplex(x, y); }
@@ -102,11 +147,14 @@ extern "C"
   WN_INLINE WN_DECIMAL  GetSimplexFractal2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetSimplexFractal(x, y); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetSimplexFractalStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetSimplexFractalSquare(startX, startY, width, height); }
+  WN_INLINE WN_DECIMAL *GetSimplexFractal2_SquarePyramid(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 levels) { return wasmNoise.GetSimplexFractalSquarePyramid(startX, startY, width, height, levels); }
 
   WN_INLINE WN_DECIMAL  GetSimplexFractal3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetSimplexFractal(x, y, z); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetSimplexFractalStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetSimplexFractalSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetSimplexFractalCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE uint32 *GetSimplexFractal2_SquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold) { return wasmNoise.GetSimplexFractalSquareMask(startX, startY, width, height, threshold); }
+  WN_INLINE uint32 *GetSimplexFractal3_CubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold) { return wasmNoise.GetSimplexFractalCubeMask(startX, startY, startZ, width, height, depth, threshold); }
 
   WN_INLINE WN_DECIMAL  GetSimplexFractal4(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) { return wasmNoise.GetSimplexFractal(x, y, z, w); }
   WN_INLINE WN_DECIMAL *GetSimplexFractal4_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, int32 direction) { return wasmNoise.GetSimplexFractalStrip(startX, startY, startZ, startW, length, static_cast<WasmNoise::StripDirection>(direction)); }
@@ -117,6 +165,7 @@ extern "C"
   WN_INLINE WN_DECIMAL  GetCellular2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetCellular(x, y); }
   WN_INLINE WN_DECIMAL *GetCellular2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetCellularStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
   WN_INLINE WN_DECIMAL *GetCellular2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetCellularSquare(startX, startY, width, height); }
+  WN_INLINE WN_DECIMAL *GetCellular2_SquareOutputs(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, uint32 outputs) { return wasmNoise.GetCellularSquareOutputs(startX, startY, width, height, outputs); }
 
   WN_INLINE WN_DECIMAL  GetCellular3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetCellular(x, y, z); }
   WN_INLINE WN_DECIMAL *GetCellular3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetCellularStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
@@ -133,5 +182,121 @@ extern "C"
   WN_INLINE WN_DECIMAL *GetCellularFractal3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetCellularFractalSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
   WN_INLINE WN_DECIMAL *GetCellularFractal3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetCellularFractalCube(startX, startY, startZ, width, height, depth); }
 #endif // WN_INCLUDE_CELLULAR_FRACTAL
+#ifdef WN_INCLUDE_VALUE
+  WN_INLINE WN_DECIMAL  GetValue2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetValue(x, y); }
+  WN_INLINE WN_DECIMAL *GetValue2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetValueStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValue2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetValueSquare(startX, startY, width, height); }
+
+  WN_INLINE WN_DECIMAL  GetValue3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetValue(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetValue3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetValueStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValue3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetValueSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetValue3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetValueCube(startX, startY, startZ, width, height, depth); }
+
+  WN_INLINE WN_DECIMAL  GetValue4(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) { return wasmNoise.GetValue(x, y, z, w); }
+  WN_INLINE WN_DECIMAL *GetValue4_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, int32 direction) { return wasmNoise.GetValueStrip(startX, startY, startZ, startW, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValue4_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetValueSquare(startX, startY, startZ, startW, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetValue4_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetValueCube(startX, startY, startZ, startW, width, height, depth); }
+#endif // WN_INCLUDE_VALUE
+#ifdef WN_INCLUDE_VALUE_FRACTAL
+  WN_INLINE WN_DECIMAL  GetValueFractal2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetValueFractal(x, y); }
+  WN_INLINE WN_DECIMAL *GetValueFractal2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetValueFractalStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValueFractal2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetValueFractalSquare(startX, startY, width, height); }
+
+  WN_INLINE WN_DECIMAL  GetValueFractal3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetValueFractal(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetValueFractal3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetValueFractalStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValueFractal3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetValueFractalSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetValueFractal3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetValueFractalCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE uint32 *GetValueFractal2_SquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold) { return wasmNoise.GetValueFractalSquareMask(startX, startY, width, height, threshold); }
+  WN_INLINE uint32 *GetValueFractal3_CubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold) { return wasmNoise.GetValueFractalCubeMask(startX, startY, startZ, width, height, depth, threshold); }
+  WN_INLINE WN_DECIMAL *GetValueFractal3_SparseCube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold) { return wasmNoise.GetValueFractalSparseCube(startX, startY, startZ, width, height, depth, threshold); }
+  WN_INLINE uint32 *GetSparseBrickMap() { return wasmNoise.GetSparseBrickMap(); }
+  WN_INLINE uint32  GetSparseBrickCount() { return wasmNoise.GetSparseBrickCount(); }
+
+  WN_INLINE WN_DECIMAL  GetValueFractal4(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) { return wasmNoise.GetValueFractal(x, y, z, w); }
+  WN_INLINE WN_DECIMAL *GetValueFractal4_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, int32 direction) { return wasmNoise.GetValueFractalStrip(startX, startY, startZ, startW, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetValueFractal4_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetValueFractalSquare(startX, startY, startZ, startW, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetValueFractal4_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetValueFractalCube(startX, startY, startZ, startW, width, height, depth); }
+#endif // WN_INCLUDE_VALUE_FRACTAL
+#ifdef WN_INCLUDE_CUBIC
+  WN_INLINE WN_DECIMAL  GetCubic2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetCubic(x, y); }
+  WN_INLINE WN_DECIMAL *GetCubic2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetCubicStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetCubic2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetCubicSquare(startX, startY, width, height); }
+
+  WN_INLINE WN_DECIMAL  GetCubic3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetCubic(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetCubic3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetCubicStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetCubic3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetCubicSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetCubic3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetCubicCube(startX, startY, startZ, width, height, depth); }
+#endif // WN_INCLUDE_CUBIC
+#ifdef WN_INCLUDE_CUBIC_FRACTAL
+  WN_INLINE WN_DECIMAL  GetCubicFractal2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetCubicFractal(x, y); }
+  WN_INLINE WN_DECIMAL *GetCubicFractal2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetCubicFractalStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetCubicFractal2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetCubicFractalSquare(startX, startY, width, height); }
+
+  WN_INLINE WN_DECIMAL  GetCubicFractal3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetCubicFractal(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetCubicFractal3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetCubicFractalStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetCubicFractal3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetCubicFractalSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetCubicFractal3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetCubicFractalCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE uint32 *GetCubicFractal2_SquareMask(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height, WN_DECIMAL threshold) { return wasmNoise.GetCubicFractalSquareMask(startX, startY, width, height, threshold); }
+  WN_INLINE uint32 *GetCubicFractal3_CubeMask(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL threshold) { return wasmNoise.GetCubicFractalCubeMask(startX, startY, startZ, width, height, depth, threshold); }
+#endif // WN_INCLUDE_CUBIC_FRACTAL
+#ifdef WN_INCLUDE_WHITE
+  WN_INLINE WN_DECIMAL  GetWhiteNoise2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetWhiteNoise(x, y); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetWhiteNoiseSquare(startX, startY, width, height); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise2_Points(const WN_DECIMAL *coords, uint32 count) { return wasmNoise.GetWhiteNoisePoints(coords, count, 2); }
+
+  WN_INLINE WN_DECIMAL  GetWhiteNoise3(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z) { return wasmNoise.GetWhiteNoise(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise3_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise3_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetWhiteNoiseSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise3_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetWhiteNoiseCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise3_Points(const WN_DECIMAL *coords, uint32 count) { return wasmNoise.GetWhiteNoisePoints(coords, count, 3); }
+
+  WN_INLINE WN_DECIMAL  GetWhiteNoise4(WN_DECIMAL x, WN_DECIMAL y, WN_DECIMAL z, WN_DECIMAL w) { return wasmNoise.GetWhiteNoise(x, y, z, w); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise4_Strip(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseStrip(startX, startY, startZ, startW, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise4_Square(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetWhiteNoiseSquare(startX, startY, startZ, startW, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise4_Cube(WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, WN_DECIMAL startW, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetWhiteNoiseCube(startX, startY, startZ, startW, width, height, depth); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoise4_Points(const WN_DECIMAL *coords, uint32 count) { return wasmNoise.GetWhiteNoisePoints(coords, count, 4); }
+
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt2(int32 x, int32 y) { return wasmNoise.GetWhiteNoiseInt(x, y); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt2_Strip(int32 startX, int32 startY, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseIntStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt2_Square(int32 startX, int32 startY, uint32 width, uint32 height) { return wasmNoise.GetWhiteNoiseIntSquare(startX, startY, width, height); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt2_Points(const int32 *coords, uint32 count) { return wasmNoise.GetWhiteNoiseIntPoints(coords, count, 2); }
+
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt3(int32 x, int32 y, int32 z) { return wasmNoise.GetWhiteNoiseInt(x, y, z); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt3_Strip(int32 startX, int32 startY, int32 startZ, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseIntStrip(startX, startY, startZ, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt3_Square(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetWhiteNoiseIntSquare(startX, startY, startZ, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt3_Cube(int32 startX, int32 startY, int32 startZ, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetWhiteNoiseIntCube(startX, startY, startZ, width, height, depth); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt3_Points(const int32 *coords, uint32 count) { return wasmNoise.GetWhiteNoiseIntPoints(coords, count, 3); }
+
+  WN_INLINE WN_DECIMAL  GetWhiteNoiseInt4(int32 x, int32 y, int32 z, int32 w) { return wasmNoise.GetWhiteNoiseInt(x, y, z, w); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt4_Strip(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 length, int32 direction) { return wasmNoise.GetWhiteNoiseIntStrip(startX, startY, startZ, startW, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt4_Square(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, int32 plane) { return wasmNoise.GetWhiteNoiseIntSquare(startX, startY, startZ, startW, width, height, static_cast<WasmNoise::SquarePlane>(plane)); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt4_Cube(int32 startX, int32 startY, int32 startZ, int32 startW, uint32 width, uint32 height, uint32 depth) { return wasmNoise.GetWhiteNoiseIntCube(startX, startY, startZ, startW, width, height, depth); }
+  WN_INLINE WN_DECIMAL *GetWhiteNoiseInt4_Points(const int32 *coords, uint32 count) { return wasmNoise.GetWhiteNoiseIntPoints(coords, count, 4); }
+#endif // WN_INCLUDE_WHITE
+#ifdef WN_INCLUDE_VIEWPORT
+  // Keep the returned pointer, panning regenerates the exposed edges in place and returns
+  // the new ring offset (ringY * width + ringX) into the buffer
+  WN_INLINE WN_DECIMAL *SetViewport(int32 noiseType, WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.SetViewport(static_cast<WasmNoise::NoiseType>(noiseType), startX, startY, width, height); }
+  WN_INLINE uint32 PanViewport(int32 dx, int32 dy) { return wasmNoise.PanViewport(dx, dy); }
+  WN_INLINE uint32 GetViewportRingOffset() { return wasmNoise.GetViewportRingOffset(); }
+#endif // WN_INCLUDE_VIEWPORT
+#ifdef WN_INCLUDE_GRAPH
+  // nodes points to nodeCount records of 4 decimals (see WasmNoise::SetGraph), e.g. from AllocateBuffer
+  WN_INLINE int32 SetGraph(const WN_DECIMAL *nodes, uint32 nodeCount) { return wasmNoise.SetGraph(nodes, nodeCount) ? 1 : 0; }
+  WN_INLINE void ClearGraph() { wasmNoise.ClearGraph(); }
+
+  WN_INLINE WN_DECIMAL  GetGraph2(WN_DECIMAL x, WN_DECIMAL y) { return wasmNoise.GetGraph(x, y); }
+  WN_INLINE WN_DECIMAL *GetGraph2_Strip(WN_DECIMAL startX, WN_DECIMAL startY, uint32 length, int32 direction) { return wasmNoise.GetGraphStrip(startX, startY, length, static_cast<WasmNoise::StripDirection>(direction)); }
+  WN_INLINE WN_DECIMAL *GetGraph2_Square(WN_DECIMAL startX, WN_DECIMAL startY, uint32 width, uint32 height) { return wasmNoise.GetGraphSquare(startX, startY, width, height); }
+#endif // WN_INCLUDE_GRAPH
+#ifdef WN_INCLUDE_MESH
+  // Both return the vertex buffer, 6 decimals per vertex (position then normal), see WasmNoise::GetIsoSurface
+  WN_INLINE WN_DECIMAL *GetIsoSurface3(int32 noiseType, WN_DECIMAL startX, WN_DECIMAL startY, WN_DECIMAL startZ, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel) { return wasmNoise.GetIsoSurface(static_cast<WasmNoise::NoiseType>(noiseType), startX, startY, startZ, width, height, depth, isoLevel); }
+  WN_INLINE WN_DECIMAL *GetIsoSurface3_FromCube(const WN_DECIMAL *values, uint32 width, uint32 height, uint32 depth, WN_DECIMAL isoLevel) { return wasmNoise.GetIsoSurfaceFromCube(values, width, height, depth, isoLevel); }
+  WN_INLINE uint32 GetMeshVertexCount() { return wasmNoise.GetMeshVertexCount(); }
+  WN_INLINE uint32 *GetMeshIndices() { return wasmNoise.GetMeshIndices(); }
+  WN_INLINE uint32 GetMeshIndexCount() { return wasmNoise.GetMeshIndexCount(); }
+#endif // WN_INCLUDE_MESH
 }
 
@@ -17,8 +17,17 @@
 // #define WN_INCLUDE_SIMPLEX_FRACTAL
 // #define WN_INCLUDE_CELLULAR
 // #define WN_INCLUDE_CELLULAR_FRACTAL
+// #define WN_INCLUDE_VALUE
+// #define WN_INCLUDE_VALUE_FRACTAL
+// #define WN_INCLUDE_CUBIC
+// #define WN_INCLUDE_CUBIC_FRACTAL
+// #define WN_INCLUDE_WHITE
+// #define WN_INCLUDE_VIEWPORT
+// #define WN_INCLUDE_GRAPH
+// #define WN_INCLUDE_MESH
 
-// Until JavaScript and WebAssembly support returning doubles (f64) we're stuck with floats
+// Floats (f32) by default, build with -UseDoubles for an f64 build which keeps its precision at large
+// world coordinates. Lattice coordinates still have to fit in an int32
 #ifdef WN_USE_DOUBLES
 using WN_DECIMAL = double;
 #else